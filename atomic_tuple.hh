@@ -0,0 +1,344 @@
+#ifndef Z_AKR_ATOMIC_TUPLE_HH
+#define Z_AKR_ATOMIC_TUPLE_HH
+
+#include "tuple.hh"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+namespace akr
+{
+    struct AtomicTupleLock final
+    {
+        private:
+        inline static constexpr std::size_t Count = 64;
+
+        struct alignas(64) Stripe final
+        {
+            public:
+            std::atomic_flag flag;
+        };
+
+        inline static Stripe stripes[Count] {};
+
+        public:
+        static auto Acquire(const void* address) noexcept -> std::atomic_flag&
+        {
+            auto&& flag = stripes[(reinterpret_cast<std::uintptr_t>(address) >> 4) % Count].flag;
+
+            while (flag.test_and_set(std::memory_order_acquire))
+            {
+                flag.wait(true, std::memory_order_relaxed);
+            }
+
+            return flag;
+        }
+
+        static void Release(std::atomic_flag& flag) noexcept
+        {
+            flag.clear(std::memory_order_release);
+
+            flag.notify_one();
+        }
+    };
+
+    template<class... T>
+    requires(std::is_trivially_copyable_v<Tuple<T...>> && sizeof(Tuple<T...>) <= 16)
+    struct AtomicTuple final
+    {
+        private:
+        #if defined(__x86_64__) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+        inline static constexpr bool HasWide = true;
+
+        using Wide = unsigned __int128;
+        #else
+        inline static constexpr bool HasWide = false;
+
+        using Wide = std::uint64_t;
+        #endif
+
+        using Word = std::conditional_t<sizeof(Tuple<T...>) <= 4, std::uint32_t,
+                     std::conditional_t<sizeof(Tuple<T...>) <= 8, std::uint64_t, Wide>>;
+
+        public:
+        // Tuples over 8 bytes are lock-free only on x86-64 built with -mcx16, which provides cmpxchg16b.
+        inline static constexpr bool IsLockFree = sizeof(Tuple<T...>) <= 8 || HasWide;
+
+        private:
+        using Storage = std::conditional_t<sizeof(Tuple<T...>) <= 8, std::atomic<Word>,
+                        std::conditional_t<IsLockFree, Word, Tuple<T...>>>;
+
+        alignas(sizeof(Tuple<T...>) <= 8 ? alignof(Storage) : 16) mutable Storage storage {};
+
+        public:
+        AtomicTuple() noexcept = default;
+
+        explicit AtomicTuple(const Tuple<T...>& value) noexcept
+        {
+            if constexpr (IsLockFree)
+            {
+                storage = toWord(value);
+            }
+            else
+            {
+                storage = clearPadding(value);
+            }
+        }
+
+        AtomicTuple(const AtomicTuple&) = delete;
+
+        public:
+        auto operator=(const AtomicTuple&) -> AtomicTuple& = delete;
+
+        public:
+        auto Load(std::memory_order order = std::memory_order_seq_cst) const noexcept -> Tuple<T...>
+        {
+            if constexpr (sizeof(Tuple<T...>) <= 8)
+            {
+                return fromWord(storage.load(order));
+            }
+            else if constexpr (IsLockFree)
+            {
+                // cmpxchg16b is the only 16-byte atomic read, and it always writes the cache line back.
+                return fromWord(__sync_val_compare_and_swap(&storage, Word(), Word()));
+            }
+            else
+            {
+                auto&& flag = AtomicTupleLock::Acquire(this);
+
+                auto value = storage;
+
+                AtomicTupleLock::Release(flag);
+
+                return value;
+            }
+        }
+
+        void Store(const Tuple<T...>& value, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            if constexpr (sizeof(Tuple<T...>) <= 8)
+            {
+                storage.store(toWord(value), order);
+            }
+            else if constexpr (IsLockFree)
+            {
+                auto expected = Word();
+                auto desired  = toWord(value);
+
+                for (auto current = Word(); (current = __sync_val_compare_and_swap(&storage, expected, desired)) != expected;)
+                {
+                    expected = current;
+                }
+            }
+            else
+            {
+                auto&& flag = AtomicTupleLock::Acquire(this);
+
+                storage = clearPadding(value);
+
+                AtomicTupleLock::Release(flag);
+            }
+        }
+
+        // The 16-byte and locked paths are always sequentially consistent, which satisfies any requested ordering.
+        auto CompareExchange(Tuple<T...>& expected, const Tuple<T...>& desired,
+                             std::memory_order success, std::memory_order failure) noexcept -> bool
+        {
+            if constexpr (sizeof(Tuple<T...>) <= 8)
+            {
+                auto word = toWord(expected);
+
+                if (storage.compare_exchange_strong(word, toWord(desired), success, failure))
+                {
+                    return true;
+                }
+
+                expected = fromWord(word);
+
+                return false;
+            }
+            else if constexpr (IsLockFree)
+            {
+                auto word    = toWord(expected);
+                auto current = __sync_val_compare_and_swap(&storage, word, toWord(desired));
+
+                if (current == word)
+                {
+                    return true;
+                }
+
+                expected = fromWord(current);
+
+                return false;
+            }
+            else
+            {
+                auto&& flag = AtomicTupleLock::Acquire(this);
+
+                auto equal = sameBytes(storage, expected);
+
+                if (equal)
+                {
+                    storage  = clearPadding(desired);
+                }
+                else
+                {
+                    expected = storage;
+                }
+
+                AtomicTupleLock::Release(flag);
+
+                return equal;
+            }
+        }
+
+        auto CompareExchange(Tuple<T...>& expected, const Tuple<T...>& desired,
+                             std::memory_order order = std::memory_order_seq_cst) noexcept -> bool
+        {
+            auto failure = order == std::memory_order_acq_rel ? std::memory_order_acquire
+                         : order == std::memory_order_release ? std::memory_order_relaxed : order;
+
+            return CompareExchange(expected, desired, order, failure);
+        }
+
+        template<class F>
+        auto Update(const F& func) noexcept(noexcept(func(std::declval<const Tuple<T...>&>()))) -> Tuple<T...>
+        {
+            auto expected = Load(std::memory_order_relaxed);
+
+            while (true)
+            {
+                auto desired = Tuple<T...>(func(static_cast<const Tuple<T...>&>(expected)));
+
+                if (CompareExchange(expected, desired))
+                {
+                    return desired;
+                }
+            }
+        }
+
+        private:
+        static auto clearPadding(Tuple<T...> value) noexcept -> Tuple<T...>
+        {
+            #if defined(__has_builtin)
+            #if __has_builtin(__builtin_clear_padding)
+            __builtin_clear_padding(&value);
+            #endif
+            #endif
+
+            return value;
+        }
+
+        // Compares element by element, so padding between elements never takes part even without __builtin_clear_padding.
+        static auto sameBytes(const Tuple<T...>& lhs, const Tuple<T...>& rhs) noexcept -> bool
+        {
+            auto l = clearPadding(lhs);
+            auto r = clearPadding(rhs);
+
+            return [&]<std::size_t... I_>(std::index_sequence<I_...>)
+            {
+                return (... && !std::memcmp(&l.template IndexOf<I_>(), &r.template IndexOf<I_>(), sizeof(T)));
+            }
+            (std::index_sequence_for<T...>());
+        }
+
+        static auto toWord(const Tuple<T...>& value) noexcept -> Word
+        {
+            auto clean = clearPadding(value);
+            auto word  = Word();
+
+            std::memcpy(&word, &clean, sizeof(Tuple<T...>));
+
+            return word;
+        }
+
+        static auto fromWord(const Word& word) noexcept -> Tuple<T...>
+        {
+            auto value = Tuple<T...>();
+
+            std::memcpy(static_cast<void*>(&value), &word, sizeof(Tuple<T...>));
+
+            return value;
+        }
+    };
+
+    template<class... T>
+    explicit AtomicTuple(const Tuple<T...>& value) -> AtomicTuple<T...>;
+}
+
+#ifdef  D_AKR_TEST
+#include <thread>
+#include <vector>
+
+namespace akr::test
+{
+    AKR_TEST(AtomicTuple,
+    {
+        using T1 = Tuple<std::uint32_t, std::uint32_t, std::uint64_t>;
+
+        static_assert(AtomicTuple<int>::IsLockFree);
+        static_assert(AtomicTuple<int, int>::IsLockFree);
+        static_assert(sizeof(AtomicTuple<int, int>) == sizeof(Tuple<int, int>));
+
+        auto a1 = AtomicTuple(Tuple(1, 'A'));
+        AKR_CHECK(a1.Load().IndexOf<0>() == 1);
+        AKR_CHECK(a1.Load().IndexOf<1>() == 'A');
+
+        a1.Store(Tuple(2, 'B'));
+        AKR_CHECK(a1.Load().IndexOf<0>() == 2);
+
+        auto e1 = Tuple(1, 'A');
+        AKR_CHECK(!a1.CompareExchange(e1, Tuple(3, 'C')));
+        AKR_CHECK(e1.IndexOf<0>() == 2);
+        AKR_CHECK(e1.IndexOf<1>() == 'B');
+        AKR_CHECK( a1.CompareExchange(e1, Tuple(3, 'C')));
+        AKR_CHECK(a1.Load().IndexOf<1>() == 'C');
+        AKR_CHECK(!a1.CompareExchange(e1, Tuple(4, 'D'), std::memory_order_acq_rel, std::memory_order_acquire));
+        AKR_CHECK(e1.IndexOf<1>() == 'C');
+        AKR_CHECK( a1.CompareExchange(e1, Tuple(4, 'D'), std::memory_order_release));
+        AKR_CHECK(a1.Load(std::memory_order_acquire).IndexOf<0>() == 4);
+
+        auto a2 = AtomicTuple(T1(1u, 2u, std::uint64_t(3)));
+        auto e2 = T1(1u, 2u, std::uint64_t(3));
+        AKR_CHECK( a2.CompareExchange(e2, T1(4u, 5u, std::uint64_t(6))));
+        AKR_CHECK(a2.Load().IndexOf<2>() == 6);
+
+        using T2 = Tuple<char, std::uint64_t>;
+
+        auto a3 = AtomicTuple(T2('A', std::uint64_t(1)));
+        auto e3 = T2();
+        std::memset(static_cast<void*>(&e3), 0xAB, sizeof(T2));
+        e3.IndexOf<0>() = 'A';
+        e3.IndexOf<1>() = 1;
+        AKR_CHECK( a3.CompareExchange(e3, T2('B', std::uint64_t(2))));
+        AKR_CHECK(a3.Load().IndexOf<0>() == 'B');
+        AKR_CHECK(a3.Load().IndexOf<1>() == 2);
+
+        auto threads = std::vector<std::thread>();
+
+        for (auto i = 0; i != 4; ++i)
+        {
+            threads.emplace_back([&]()
+            {
+                for (auto j = 0; j != 10000; ++j)
+                {
+                    a2.Update([](auto&& e) { return T1(e.template IndexOf<0>() + 1, e.template IndexOf<1>(),
+                                                      e.template IndexOf<2>() + 2); });
+                }
+            });
+        }
+
+        for (auto&& thread : threads)
+        {
+            thread.join();
+        }
+
+        AKR_CHECK(a2.Load().IndexOf<0>() == 40004);
+        AKR_CHECK(a2.Load().IndexOf<1>() == 5);
+        AKR_CHECK(a2.Load().IndexOf<2>() == 80006);
+    });
+}
+#endif//D_AKR_TEST
+
+#endif//Z_AKR_ATOMIC_TUPLE_HH
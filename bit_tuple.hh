@@ -0,0 +1,358 @@
+#ifndef Z_AKR_BIT_TUPLE_HH
+#define Z_AKR_BIT_TUPLE_HH
+
+#include "tuple.hh"
+
+#include <cstdint>
+#include <functional>
+
+namespace akr
+{
+    template<std::size_t N>
+    using BitsType = std::conditional_t<N ==  1, bool,
+                     std::conditional_t<N <=  8, std::uint8_t,
+                     std::conditional_t<N <= 16, std::uint16_t,
+                     std::conditional_t<N <= 32, std::uint32_t, std::uint64_t>>>>;
+
+    template<std::size_t N, class T = BitsType<N>>
+    requires(std::is_integral_v<T> && N != 0 && N <= (std::is_same_v<T, bool> ? 1 : sizeof(T) * 8) && N <= 64)
+    struct Bits final
+    {
+        public:
+        using Type = T;
+
+        inline static constexpr std::size_t Width = N;
+    };
+
+    template<class... B>
+    requires(sizeof...(B) != 0)
+    struct BitTuple final
+    {
+        public:
+        static constexpr auto Count = sizeof...(B);
+
+        private:
+        inline static constexpr std::size_t Widths[] = { B::Width... };
+
+        inline static constexpr std::size_t Total = (... + B::Width);
+
+        public:
+        using Word = std::conditional_t<Total <=  8, std::uint8_t,
+                     std::conditional_t<Total <= 16, std::uint16_t,
+                     std::conditional_t<Total <= 32, std::uint32_t, std::uint64_t>>>;
+
+        template<std::size_t I>
+        requires(I < Count)
+        using ElementType = typename TupleHelper<Tuple<B...>>::template ElementType<I>::Type;
+
+        private:
+        inline static constexpr std::size_t WordBits = sizeof(Word) * 8;
+
+        static consteval auto positionOf(std::size_t index) noexcept -> std::size_t
+        {
+            auto position = std::size_t();
+
+            for (std::size_t i = 0; ; position += Widths[i++])
+            {
+                if (position % WordBits + Widths[i] > WordBits)
+                {
+                    position = (position / WordBits + 1) * WordBits;
+                }
+
+                if (i == index)
+                {
+                    return position;
+                }
+            }
+        }
+
+        inline static constexpr std::size_t WordCount = (positionOf(Count - 1) + Widths[Count - 1] + WordBits - 1) / WordBits;
+
+        template<std::size_t I>
+        static constexpr auto maskOf() noexcept -> Word
+        {
+            return Widths[I] == WordBits ? Word(~Word()) : Word((Word(1) << Widths[I]) - 1);
+        }
+
+        template<std::size_t I>
+        static constexpr auto get(const Word* words) noexcept -> ElementType<I>
+        {
+            constexpr auto shift = positionOf(I) % WordBits;
+
+            auto bits = Word((words[positionOf(I) / WordBits] >> shift) & maskOf<I>());
+
+            if constexpr (std::is_same_v<ElementType<I>, bool>)
+            {
+                return bits != 0;
+            }
+            else if constexpr (std::is_signed_v<ElementType<I>>)
+            {
+                if (bits >> (Widths[I] - 1) & 1)
+                {
+                    bits = Word(bits | ~maskOf<I>());
+                }
+
+                return static_cast<ElementType<I>>(static_cast<std::make_signed_t<Word>>(bits));
+            }
+            else
+            {
+                return static_cast<ElementType<I>>(bits);
+            }
+        }
+
+        template<std::size_t I>
+        static constexpr void set(Word* words, const ElementType<I>& value) noexcept
+        {
+            constexpr auto shift = positionOf(I) % WordBits;
+
+            auto&& word = words[positionOf(I) / WordBits];
+
+            word = Word((word & ~Word(maskOf<I>() << shift)) | (Word(Word(value) & maskOf<I>()) << shift));
+        }
+
+        public:
+        template<std::size_t I>
+        struct Reference final
+        {
+            friend struct BitTuple;
+
+            private:
+            Word* words;
+
+            constexpr explicit Reference(Word* words_) noexcept:
+                words { words_ }
+            {
+            }
+
+            public:
+            constexpr operator ElementType<I>() const noexcept
+            {
+                return BitTuple::get<I>(words);
+            }
+
+            constexpr auto operator=(const ElementType<I>& value) const noexcept -> const Reference&
+            {
+                BitTuple::set<I>(words, value);
+
+                return *this;
+            }
+
+            constexpr auto operator=(const Reference& rhs) const noexcept -> const Reference&
+            {
+                return *this = static_cast<ElementType<I>>(rhs);
+            }
+        };
+
+        private:
+        Word words[WordCount] {};
+
+        public:
+        constexpr BitTuple() = default;
+
+        explicit constexpr BitTuple(const typename B::Type&... values) noexcept
+        {
+            [&]<std::size_t... I_>(std::index_sequence<I_...>) constexpr
+            {
+                (..., BitTuple::set<I_>(words, values));
+            }
+            (std::make_index_sequence<Count>{});
+        }
+
+        public:
+        friend constexpr auto operator==(const BitTuple& lhs, const BitTuple& rhs) noexcept -> bool
+        {
+            for (std::size_t i = 0; i != WordCount; ++i)
+            {
+                if (lhs.words[i] != rhs.words[i])
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        public:
+        template<class F>
+        constexpr void ForEach(const F& func)
+        {
+            [&]<std::size_t... I_>(std::index_sequence<I_...>) constexpr
+            {
+                (..., func(IndexOf<I_>()));
+            }
+            (std::make_index_sequence<Count>{});
+        }
+
+        template<class F>
+        constexpr void IndexBy(std::size_t index, const F& func)
+        {
+            [&]<size_t... I_>(std::index_sequence<I_...>) constexpr
+            {
+                if (index < Count)
+                {
+                    #ifdef __clang__
+                    #pragma clang diagnostic push
+                    #pragma clang diagnostic ignored "-Wunused-value"
+                    #endif
+                    (..., (I_ == index && (func(IndexOf<I_>()), false)));
+                    #ifdef __clang__
+                    #pragma clang diagnostic pop
+                    #endif
+                }
+                else
+                {
+                    throw std::out_of_range("index out of range.");
+                }
+            }
+            (std::make_index_sequence<Count>{});
+        }
+
+        template<std::size_t I>
+        requires(I < Count)
+        constexpr auto IndexOf()       noexcept -> Reference<I>
+        {
+            return Reference<I>(words);
+        }
+
+        public:
+        template<class F>
+        constexpr void ForEach(const F& func) const
+        {
+            [&]<std::size_t... I_>(std::index_sequence<I_...>) constexpr
+            {
+                (..., func(IndexOf<I_>()));
+            }
+            (std::make_index_sequence<Count>{});
+        }
+
+        template<class F>
+        constexpr void IndexBy(std::size_t index, const F& func) const
+        {
+            [&]<size_t... I_>(std::index_sequence<I_...>) constexpr
+            {
+                if (index < Count)
+                {
+                    #ifdef __clang__
+                    #pragma clang diagnostic push
+                    #pragma clang diagnostic ignored "-Wunused-value"
+                    #endif
+                    (..., (I_ == index && (func(IndexOf<I_>()), false)));
+                    #ifdef __clang__
+                    #pragma clang diagnostic pop
+                    #endif
+                }
+                else
+                {
+                    throw std::out_of_range("index out of range.");
+                }
+            }
+            (std::make_index_sequence<Count>{});
+        }
+
+        template<std::size_t I>
+        requires(I < Count)
+        constexpr auto IndexOf() const noexcept -> ElementType<I>
+        {
+            return BitTuple::get<I>(words);
+        }
+
+        auto Hash() const noexcept -> std::size_t
+        {
+            auto hash = std::hash<Word>()(words[0]);
+
+            for (std::size_t i = 1; i != WordCount; ++i)
+            {
+                hash ^= std::hash<Word>()(words[i]) + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+            }
+
+            return hash;
+        }
+    };
+}
+
+namespace std
+{
+    template<class... B>
+    struct hash<akr::BitTuple<B...>>
+    {
+        auto operator()(const akr::BitTuple<B...>& value) const noexcept -> std::size_t
+        {
+            return value.Hash();
+        }
+    };
+}
+
+#ifdef  D_AKR_TEST
+#include <unordered_set>
+
+namespace akr::test
+{
+    AKR_TEST(BitTuple,
+    {
+        using F1 = decltype(Tuple(true, true, std::uint8_t(), std::uint8_t(), true));
+
+        static_assert(std::is_same_v<bool, Bits<1>::Type>);
+        static_assert(std::is_same_v<std::uint8_t, Bits<3>::Type>);
+        static_assert(std::is_same_v<std::int8_t, Bits<3, std::int8_t>::Type>);
+
+        using T1 = BitTuple<Bits<1>, Bits<1>, Bits<3>, Bits<8>, Bits<1>>;
+        using T2 = BitTuple<Bits<4, std::int8_t>, Bits<40>, Bits<40>>;
+
+        static_assert(sizeof(BitTuple<Bits<1>>) == 1);
+        static_assert(sizeof(F1) == 5);
+        static_assert(sizeof(T1) == 2);
+        static_assert(sizeof(T2) == 16);
+
+        static_assert(T1(true, false, 5, 200, true).IndexOf<3>() == 200);
+
+        auto t1 = T1(true, false, 5, 200, true);
+        static_assert(std::is_same_v<bool, decltype(std::as_const(t1).IndexOf<0>())>);
+        static_assert(std::is_same_v<std::uint8_t, decltype(std::as_const(t1).IndexOf<2>())>);
+        AKR_CHECK(t1.IndexOf<0>() == true);
+        AKR_CHECK(t1.IndexOf<1>() == false);
+        AKR_CHECK(t1.IndexOf<2>() == 5);
+        AKR_CHECK(t1.IndexOf<3>() == 200);
+        AKR_CHECK(t1.IndexOf<4>() == true);
+
+        t1.IndexOf<2>() = 9;
+        AKR_CHECK(t1.IndexOf<2>() == 1);
+        AKR_CHECK(t1.IndexOf<3>() == 200);
+
+        t1.IndexOf<1>() = t1.IndexOf<0>();
+        AKR_CHECK(t1.IndexOf<1>() == true);
+
+        t1.IndexBy(3, [](auto&& e) { e = 7; });
+        AKR_CHECK(t1.IndexOf<3>() == 7);
+
+        auto count = 0;
+        t1.ForEach([&](auto&& e) { count += e; });
+        AKR_CHECK(count == 1 + 1 + 1 + 7 + 1);
+
+        t1.ForEach([](auto&& e) { e = 0; });
+        AKR_CHECK(t1 == T1());
+
+        auto t2 = T2(-3, 0xFFFFFFFFFFull, 1);
+        AKR_CHECK(t2.IndexOf<0>() == -3);
+        AKR_CHECK(t2.IndexOf<1>() == 0xFFFFFFFFFFull);
+        AKR_CHECK(t2.IndexOf<2>() == 1);
+        t2.IndexOf<0>() = 7;
+        AKR_CHECK(t2.IndexOf<0>() == 7);
+        t2.IndexOf<0>() = -8;
+        AKR_CHECK(t2.IndexOf<0>() == -8);
+
+        auto t3 = t2;
+        AKR_CHECK(t3 == t2);
+        AKR_CHECK(t3.Hash() == t2.Hash());
+        t3.IndexOf<2>() = 2;
+        AKR_CHECK(!(t3 == t2));
+
+        auto set = std::unordered_set<T1>();
+        set.insert(T1(true, false, 1, 2, true));
+        set.insert(T1(true, false, 1, 2, true));
+        set.insert(T1(true, false, 1, 3, true));
+        AKR_CHECK(set.size() == 2);
+    });
+}
+#endif//D_AKR_TEST
+
+#endif//Z_AKR_BIT_TUPLE_HH
@@ -0,0 +1,333 @@
+#ifndef Z_AKR_C_TUPLE_HH
+#define Z_AKR_C_TUPLE_HH
+
+#include "tuple.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace akr
+{
+    template<class... T>
+    requires(sizeof...(T) != 0 && (... && (std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T>)))
+    struct CTuple final
+    {
+        public:
+        static constexpr auto Count = sizeof...(T);
+
+        template<std::size_t I>
+        requires(I < Count)
+        using ElementType = typename TupleHelper<Tuple<T...>>::template ElementType<I>;
+
+        private:
+        inline static constexpr std::size_t Sizes     [] = { sizeof (T)... };
+
+        inline static constexpr std::size_t Alignments[] = { alignof(T)... };
+
+        static consteval auto alignUp(std::size_t offset, std::size_t alignment) noexcept -> std::size_t
+        {
+            return (offset + alignment - 1) / alignment * alignment;
+        }
+
+        static consteval auto offsetOf(std::size_t index) noexcept -> std::size_t
+        {
+            auto offset = std::size_t();
+
+            for (std::size_t i = 0; ; offset += Sizes[i++])
+            {
+                offset = alignUp(offset, Alignments[i]);
+
+                if (i == index)
+                {
+                    return offset;
+                }
+            }
+        }
+
+        static consteval auto alignment() noexcept -> std::size_t
+        {
+            auto alignment = std::size_t(1);
+
+            for (auto&& e : Alignments)
+            {
+                alignment = alignment < e ? e : alignment;
+            }
+
+            return alignment;
+        }
+
+        inline static constexpr std::size_t Alignment = alignment();
+
+        alignas(Alignment) unsigned char storage[alignUp(offsetOf(Count - 1) + Sizes[Count - 1], Alignment)] {};
+
+        public:
+        // Value-initializes every element, like Tuple, and zeroes the padding; Overlay views bytes without writing them.
+        CTuple() noexcept((... && std::is_nothrow_default_constructible_v<T>))
+        requires((... && std::is_default_constructible_v<T>))
+        {
+            [&]<std::size_t... I_>(std::index_sequence<I_...>)
+            {
+                (..., ::new (static_cast<void*>(storage + OffsetOf<I_>())) T());
+            }
+            (std::make_index_sequence<Count>{});
+        }
+
+        template<class... V>
+        requires(sizeof...(V) == Count && !(Count == 1 && (... && TupleHelper<V>::IsTuple)))
+        explicit CTuple(V&&... values)
+            noexcept((... && std::is_nothrow_constructible_v<T, V&&>))
+        {
+            [&]<std::size_t... I_>(std::index_sequence<I_...>)
+            {
+                (..., ::new (static_cast<void*>(storage + OffsetOf<I_>())) T { std::forward<V>(values) });
+            }
+            (std::make_index_sequence<Count>{});
+        }
+
+        template<class V>
+        requires(TupleHelper<V>::IsTuple && Count == TupleHelper<V>::CountOf())
+        explicit CTuple(const V& value_)
+            noexcept(noexcept(CTuple(std::declval<const T&>()...))):
+            CTuple([&]<std::size_t... I_>(std::index_sequence<I_...>)
+            {
+                return CTuple(value_.template IndexOf<I_>()...);
+            }
+            (std::make_index_sequence<Count>{}))
+        {
+        }
+
+        public:
+        template<class B, std::size_t N>
+        requires(std::is_same_v<std::remove_const_t<B>, std::byte>)
+        static auto Overlay(std::span<B, N> bytes) -> std::conditional_t<std::is_const_v<B>, const CTuple&, CTuple&>
+        {
+            check(bytes.data(), bytes.size());
+
+            return *std::launder(reinterpret_cast<std::conditional_t<std::is_const_v<B>, const CTuple*, CTuple*>>(
+                bytes.data()));
+        }
+
+        template<std::size_t I>
+        requires(I < Count)
+        static consteval auto OffsetOf() noexcept -> std::size_t
+        {
+            return offsetOf(I);
+        }
+
+        template<std::size_t I>
+        requires(I < Count)
+        static consteval auto SizeOf() noexcept -> std::size_t
+        {
+            return Sizes[I];
+        }
+
+        public:
+        template<class F>
+        void ForEach(const F& func)
+            noexcept((... && noexcept(func(std::declval<T&>()))))
+        {
+            [&]<std::size_t... I_>(std::index_sequence<I_...>)
+            {
+                (..., func(IndexOf<I_>()));
+            }
+            (std::make_index_sequence<Count>{});
+        }
+
+        template<class F>
+        void IndexBy(std::size_t index, const F& func)
+        {
+            [&]<size_t... I_>(std::index_sequence<I_...>)
+            {
+                if (index < Count)
+                {
+                    #ifdef __clang__
+                    #pragma clang diagnostic push
+                    #pragma clang diagnostic ignored "-Wunused-value"
+                    #endif
+                    (..., (I_ == index && (func(IndexOf<I_>()), false)));
+                    #ifdef __clang__
+                    #pragma clang diagnostic pop
+                    #endif
+                }
+                else
+                {
+                    throw std::out_of_range("index out of range.");
+                }
+            }
+            (std::make_index_sequence<Count>{});
+        }
+
+        template<std::size_t I>
+        requires(I < Count)
+        auto IndexOf()       noexcept ->       ElementType<I>&
+        {
+            return *std::launder(reinterpret_cast<      ElementType<I>*>(storage + OffsetOf<I>()));
+        }
+
+        public:
+        template<class F>
+        void ForEach(const F& func) const
+            noexcept((... && noexcept(func(std::declval<const T&>()))))
+        {
+            [&]<std::size_t... I_>(std::index_sequence<I_...>)
+            {
+                (..., func(IndexOf<I_>()));
+            }
+            (std::make_index_sequence<Count>{});
+        }
+
+        template<class F>
+        void IndexBy(std::size_t index, const F& func) const
+        {
+            [&]<size_t... I_>(std::index_sequence<I_...>)
+            {
+                if (index < Count)
+                {
+                    #ifdef __clang__
+                    #pragma clang diagnostic push
+                    #pragma clang diagnostic ignored "-Wunused-value"
+                    #endif
+                    (..., (I_ == index && (func(IndexOf<I_>()), false)));
+                    #ifdef __clang__
+                    #pragma clang diagnostic pop
+                    #endif
+                }
+                else
+                {
+                    throw std::out_of_range("index out of range.");
+                }
+            }
+            (std::make_index_sequence<Count>{});
+        }
+
+        template<std::size_t I>
+        requires(I < Count)
+        auto IndexOf() const noexcept -> const ElementType<I>&
+        {
+            return *std::launder(reinterpret_cast<const ElementType<I>*>(storage + OffsetOf<I>()));
+        }
+
+        auto Materialize() const
+            noexcept((... && std::is_nothrow_copy_constructible_v<T>)) -> Tuple<T...>
+        {
+            return [&]<std::size_t... I_>(std::index_sequence<I_...>)
+            {
+                return Tuple<T...>(IndexOf<I_>()...);
+            }
+            (std::make_index_sequence<Count>{});
+        }
+
+        private:
+        static void check(const std::byte* data, std::size_t size)
+        {
+            if (size < sizeof(CTuple))
+            {
+                throw std::out_of_range("buffer too small.");
+            }
+
+            if (reinterpret_cast<std::uintptr_t>(data) % alignof(CTuple))
+            {
+                throw std::invalid_argument("buffer misaligned.");
+            }
+        }
+    };
+
+    template<class V, class... W>
+    explicit CTuple(V&& value_, W&&... values) -> CTuple<std::decay_t<V>, std::decay_t<W>...>;
+}
+
+#ifdef  D_AKR_TEST
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+namespace akr::test
+{
+    AKR_TEST(CTuple,
+    {
+        struct C1
+        {
+            char          a;
+            int           b;
+            char          c;
+            double        d;
+            std::uint16_t e;
+        };
+
+        using T1 = decltype(CTuple('A', 1, 'B', 3.14, std::uint16_t(2)));
+
+        static_assert(std::is_standard_layout_v<T1>);
+        static_assert(std::is_trivially_copyable_v<T1>);
+        static_assert(sizeof (T1) == sizeof (C1));
+        static_assert(alignof(T1) == alignof(C1));
+        static_assert(T1::OffsetOf<0>() == offsetof(C1, a));
+        static_assert(T1::OffsetOf<1>() == offsetof(C1, b));
+        static_assert(T1::OffsetOf<2>() == offsetof(C1, c));
+        static_assert(T1::OffsetOf<3>() == offsetof(C1, d));
+        static_assert(T1::OffsetOf<4>() == offsetof(C1, e));
+        static_assert(T1::SizeOf<3>() == sizeof(double));
+
+        auto t1 = T1('A', 1, 'B', 3.14, std::uint16_t(2));
+        static_assert(std::is_same_v<double&, decltype(t1.IndexOf<3>())>);
+        AKR_CHECK(t1.IndexOf<0>() == 'A');
+        AKR_CHECK(t1.IndexOf<1>() == 1);
+        AKR_CHECK(t1.IndexOf<3>() == 3.14);
+        AKR_CHECK(t1.IndexOf<4>() == 2);
+
+        auto c1 = C1();
+        std::memcpy(&c1, &t1, sizeof(c1));
+        AKR_CHECK(c1.a == 'A');
+        AKR_CHECK(c1.b == 1);
+        AKR_CHECK(c1.c == 'B');
+        AKR_CHECK(c1.d == 3.14);
+        AKR_CHECK(c1.e == 2);
+
+        t1.IndexBy(1, [](auto&& e) { e = 5; });
+        AKR_CHECK(t1.IndexOf<1>() == 5);
+
+        auto count = 0;
+        t1.ForEach([&](auto&&) { ++count; });
+        AKR_CHECK(count == 5);
+
+        auto m1 = t1.Materialize();
+        static_assert(std::is_same_v<decltype(Tuple('A', 1, 'B', 3.14, std::uint16_t(2))), decltype(m1)>);
+        AKR_CHECK(m1.IndexOf<1>() == 5);
+
+        auto t2 = T1(m1);
+        AKR_CHECK(t2.IndexOf<3>() == 3.14);
+
+        alignas(T1) std::byte buffer[sizeof(T1) + 1] {};
+        std::memcpy(buffer, &c1, sizeof(c1));
+
+        auto&& o1 = T1::Overlay(std::span(buffer));
+        AKR_CHECK(o1.IndexOf<2>() == 'B');
+        o1.IndexOf<4>() = 7;
+        AKR_CHECK(reinterpret_cast<const C1*>(buffer)->e == 7);
+
+        alignas(T1) std::byte raw[sizeof(T1)];
+        std::memset(raw, 0xAB, sizeof(raw));
+        auto* d1 = ::new (static_cast<void*>(raw)) T1;
+        AKR_CHECK(d1->IndexOf<1>() == 0);
+        AKR_CHECK(d1->IndexOf<3>() == 0.0);
+        AKR_CHECK(std::all_of(std::begin(raw), std::end(raw), [](std::byte e) { return e == std::byte(); }));
+
+        auto d2 = CTuple<int C1::*, char>();
+        AKR_CHECK(d2.IndexOf<0>() == nullptr);
+        AKR_CHECK(d2.IndexOf<1>() == 0);
+
+        auto thrown = false;
+        try
+        {
+            T1::Overlay(std::span(buffer + 1, sizeof(T1)));
+        }
+        catch (const std::invalid_argument&)
+        {
+            thrown = true;
+        }
+        AKR_CHECK(thrown);
+    });
+}
+#endif//D_AKR_TEST
+
+#endif//Z_AKR_C_TUPLE_HH
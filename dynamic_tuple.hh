@@ -0,0 +1,595 @@
+#ifndef Z_AKR_DYNAMIC_TUPLE_HH
+#define Z_AKR_DYNAMIC_TUPLE_HH
+
+#include "tuple.hh"
+
+#include <array>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace akr
+{
+    enum class DynamicType : std::uint8_t
+    {
+        Bool, Char, Int8, Int16, Int32, Int64, UInt8, UInt16, UInt32, UInt64, Float, Double, String
+    };
+
+    struct DynamicTypeHelper final
+    {
+        public:
+        using Types = std::tuple<bool, char, std::int8_t, std::int16_t, std::int32_t, std::int64_t,
+                                 std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t, float, double, std::string>;
+
+        inline static constexpr std::size_t Count = std::tuple_size_v<Types>;
+
+        template<DynamicType D>
+        using Type = std::tuple_element_t<static_cast<std::size_t>(D), Types>;
+
+        template<class T>
+        inline static constexpr std::size_t IndexOf = []<std::size_t... I_>(std::index_sequence<I_...>) constexpr
+        {
+            auto result = Count;
+
+            (void)(... || (std::is_same_v<T, std::tuple_element_t<I_, Types>> && (result = I_, true)));
+
+            return result;
+        }
+        (std::make_index_sequence<Count>{});
+
+        template<class T>
+        inline static constexpr bool IsSupported = IndexOf<T> != Count;
+
+        template<class T>
+        requires(IsSupported<T>)
+        inline static constexpr DynamicType TypeOf = static_cast<DynamicType>(IndexOf<T>);
+
+        struct Operations final
+        {
+            public:
+            std::size_t size;
+
+            std::size_t alignment;
+
+            bool trivial;
+
+            void (*construct)(void* element);
+
+            void (*copy)(void* element, const void* source);
+
+            void (*destroy)(void* element) noexcept;
+
+            const void* (*empty)() noexcept;
+        };
+
+        inline static constexpr auto Table = []<std::size_t... I_>(std::index_sequence<I_...>) constexpr
+        {
+            return std::array<Operations, Count>
+            {
+                Operations
+                {
+                    sizeof (std::tuple_element_t<I_, Types>),
+                    alignof(std::tuple_element_t<I_, Types>),
+                    std::is_trivially_copyable_v<std::tuple_element_t<I_, Types>>,
+                    [](void* element) { ::new (element) std::tuple_element_t<I_, Types>(); },
+                    [](void* element, const void* source)
+                    {
+                        ::new (element) std::tuple_element_t<I_, Types>(*static_cast<const std::tuple_element_t<I_, Types>*>(source));
+                    },
+                    [](void* element) noexcept { std::destroy_at(static_cast<std::tuple_element_t<I_, Types>*>(element)); },
+                    []() noexcept -> const void*
+                    {
+                        static const auto empty = std::tuple_element_t<I_, Types>();
+
+                        return &empty;
+                    }
+                }...
+            };
+        }
+        (std::make_index_sequence<Count>{});
+    };
+
+    struct DynamicSchema final
+    {
+        private:
+        std::vector<DynamicType> types;
+
+        std::vector<std::size_t> offsets;
+
+        std::size_t size = 0;
+
+        std::size_t alignment = 1;
+
+        bool trivial = true;
+
+        public:
+        explicit DynamicSchema(std::vector<DynamicType> types_):
+            types { std::move(types_) }
+        {
+            offsets.reserve(types.size());
+
+            for (auto type : types)
+            {
+                if (static_cast<std::size_t>(type) >= DynamicTypeHelper::Count)
+                {
+                    throw std::invalid_argument("unknown dynamic type.");
+                }
+
+                auto&& operations = DynamicTypeHelper::Table[static_cast<std::size_t>(type)];
+
+                size = (size + operations.alignment - 1) / operations.alignment * operations.alignment;
+
+                offsets.push_back(size);
+
+                size += operations.size;
+
+                alignment = std::max(alignment, operations.alignment);
+
+                trivial = trivial && operations.trivial;
+            }
+
+            size = (size + alignment - 1) / alignment * alignment;
+        }
+
+        explicit DynamicSchema(std::initializer_list<DynamicType> types_):
+            DynamicSchema(std::vector<DynamicType>(types_))
+        {
+        }
+
+        public:
+        template<class... T>
+        requires(sizeof...(T) != 0 && (... && DynamicTypeHelper::IsSupported<T>))
+        static auto Of() -> const std::shared_ptr<const DynamicSchema>&
+        {
+            static const auto schema = std::make_shared<const DynamicSchema>(std::vector<DynamicType> { DynamicTypeHelper::TypeOf<T>... });
+
+            return schema;
+        }
+
+        public:
+        auto Count() const noexcept -> std::size_t
+        {
+            return types.size();
+        }
+
+        auto Size() const noexcept -> std::size_t
+        {
+            return size;
+        }
+
+        auto Alignment() const noexcept -> std::size_t
+        {
+            return alignment;
+        }
+
+        auto IsTrivial() const noexcept -> bool
+        {
+            return trivial;
+        }
+
+        auto TypeOf(std::size_t index) const -> DynamicType
+        {
+            return types.at(index);
+        }
+
+        auto OffsetOf(std::size_t index) const -> std::size_t
+        {
+            return offsets.at(index);
+        }
+
+        template<class... T>
+        auto Matches() const noexcept -> bool
+        {
+            if constexpr ((... && DynamicTypeHelper::IsSupported<T>))
+            {
+                return types == std::vector<DynamicType> { DynamicTypeHelper::TypeOf<T>... };
+            }
+            else
+            {
+                return false;
+            }
+        }
+    };
+
+    struct DynamicTuple final
+    {
+        private:
+        std::shared_ptr<const DynamicSchema> schema;
+
+        std::byte* data = nullptr;
+
+        auto allocate() const -> std::byte*
+        {
+            return static_cast<std::byte*>(::operator new(std::max(schema->Size(), std::size_t(1)), std::align_val_t(schema->Alignment())));
+        }
+
+        void deallocate() noexcept
+        {
+            ::operator delete(data, std::max(schema->Size(), std::size_t(1)), std::align_val_t(schema->Alignment()));
+        }
+
+        void destroy(std::size_t count) noexcept
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                DynamicTypeHelper::Table[static_cast<std::size_t>(schema->TypeOf(i))].destroy(data + schema->OffsetOf(i));
+            }
+        }
+
+        auto element(std::size_t index) -> std::byte*
+        {
+            if (!data)
+            {
+                construct([&](std::size_t index_, void* element_)
+                {
+                    DynamicTypeHelper::Table[static_cast<std::size_t>(schema->TypeOf(index_))].construct(element_);
+                });
+            }
+
+            return data + schema->OffsetOf(index);
+        }
+
+        auto element(std::size_t index) const -> const std::byte*
+        {
+            if (!data)
+            {
+                return static_cast<const std::byte*>(DynamicTypeHelper::Table[static_cast<std::size_t>(schema->TypeOf(index))].empty());
+            }
+
+            return data + schema->OffsetOf(index);
+        }
+
+        template<class B, class F>
+        static void visit(DynamicType type, B* element, const F& func)
+        {
+            static constexpr auto table = []<std::size_t... I_>(std::index_sequence<I_...>) constexpr
+            {
+                return std::array<void (*)(B*, const F&), DynamicTypeHelper::Count>
+                {
+                    [](B* element_, const F& func_)
+                    {
+                        using E = std::conditional_t<std::is_const_v<B>, const std::tuple_element_t<I_, DynamicTypeHelper::Types>,
+                                                                               std::tuple_element_t<I_, DynamicTypeHelper::Types>>;
+
+                        func_(*std::launder(reinterpret_cast<E*>(element_)));
+                    }...
+                };
+            }
+            (std::make_index_sequence<DynamicTypeHelper::Count>{});
+
+            table[static_cast<std::size_t>(type)](element, func);
+        }
+
+        template<class F>
+        void construct(const F& func)
+        {
+            data = allocate();
+
+            auto count = std::size_t(0);
+
+            try
+            {
+                for (; count != schema->Count(); ++count)
+                {
+                    func(count, data + schema->OffsetOf(count));
+                }
+            }
+            catch (...)
+            {
+                destroy(count);
+
+                deallocate();
+
+                throw;
+            }
+        }
+
+        public:
+        explicit DynamicTuple(std::shared_ptr<const DynamicSchema> schema_):
+            schema { std::move(schema_) }
+        {
+            construct([&](std::size_t index, void* element)
+            {
+                DynamicTypeHelper::Table[static_cast<std::size_t>(schema->TypeOf(index))].construct(element);
+            });
+        }
+
+        template<class... T>
+        explicit DynamicTuple(std::shared_ptr<const DynamicSchema> schema_, const Tuple<T...>& tuple):
+            schema { std::move(schema_) }
+        {
+            if (!schema->Matches<T...>())
+            {
+                throw std::invalid_argument("schema mismatch.");
+            }
+
+            construct([&](std::size_t index, void* element)
+            {
+                tuple.IndexBy(index, [&](auto&& e) { ::new (element) std::remove_cvref_t<decltype(e)>(e); });
+            });
+        }
+
+        template<class... T>
+        requires(sizeof...(T) != 0 && (... && DynamicTypeHelper::IsSupported<T>))
+        explicit DynamicTuple(const Tuple<T...>& tuple):
+            DynamicTuple(DynamicSchema::Of<T...>(), tuple)
+        {
+        }
+
+        DynamicTuple(const DynamicTuple& rhs):
+            schema { rhs.schema }
+        {
+            if (!rhs.data)
+            {
+                return;
+            }
+
+            if (schema->IsTrivial())
+            {
+                data = allocate();
+
+                std::memcpy(data, rhs.data, schema->Size());
+            }
+            else
+            {
+                construct([&](std::size_t index, void* element)
+                {
+                    DynamicTypeHelper::Table[static_cast<std::size_t>(schema->TypeOf(index))].copy(element, rhs.element(index));
+                });
+            }
+        }
+
+        // Takes over rhs's storage. A moved-from DynamicTuple keeps its schema and reads its elements as
+        // default-constructed; its first mutable access allocates a fresh row.
+        DynamicTuple(DynamicTuple&& rhs) noexcept:
+            schema { rhs.schema },
+            data   { std::exchange(rhs.data, nullptr) }
+        {
+        }
+
+        ~DynamicTuple()
+        {
+            if (data)
+            {
+                destroy(schema->Count());
+
+                deallocate();
+            }
+        }
+
+        public:
+        auto operator=(const DynamicTuple& rhs) -> DynamicTuple&
+        {
+            if (this != &rhs)
+            {
+                *this = DynamicTuple(rhs);
+            }
+
+            return *this;
+        }
+
+        auto operator=(DynamicTuple&& rhs) noexcept -> DynamicTuple&
+        {
+            std::swap(schema, rhs.schema);
+            std::swap(data  , rhs.data  );
+
+            return *this;
+        }
+
+        public:
+        auto Schema() const noexcept -> const DynamicSchema&
+        {
+            return *schema;
+        }
+
+        auto Count() const noexcept -> std::size_t
+        {
+            return schema->Count();
+        }
+
+        template<class T>
+        requires(DynamicTypeHelper::IsSupported<T>)
+        auto Get(std::size_t index)       ->       T&
+        {
+            if (schema->TypeOf(index) != DynamicTypeHelper::TypeOf<T>)
+            {
+                throw std::invalid_argument("type mismatch.");
+            }
+
+            return *std::launder(reinterpret_cast<T*>(element(index)));
+        }
+
+        template<class T>
+        requires(DynamicTypeHelper::IsSupported<T>)
+        auto Get(std::size_t index) const -> const T&
+        {
+            if (schema->TypeOf(index) != DynamicTypeHelper::TypeOf<T>)
+            {
+                throw std::invalid_argument("type mismatch.");
+            }
+
+            return *std::launder(reinterpret_cast<const T*>(element(index)));
+        }
+
+        template<class F>
+        void IndexBy(std::size_t index, const F& func)
+        {
+            if (index < schema->Count())
+            {
+                DynamicTuple::visit(schema->TypeOf(index), element(index), func);
+            }
+            else
+            {
+                throw std::out_of_range("index out of range.");
+            }
+        }
+
+        template<class F>
+        void ForEach(const F& func)
+        {
+            for (std::size_t i = 0; i != schema->Count(); ++i)
+            {
+                IndexBy(i, func);
+            }
+        }
+
+        template<class... T>
+        requires(sizeof...(T) != 0)
+        auto To() const -> Tuple<T...>
+        {
+            if (!schema->Matches<T...>())
+            {
+                throw std::invalid_argument("schema mismatch.");
+            }
+
+            return [&]<std::size_t... I_>(std::index_sequence<I_...>)
+            {
+                return Tuple<T...>(Get<T>(I_)...);
+            }
+            (std::index_sequence_for<T...>{});
+        }
+
+        public:
+        template<class F>
+        void IndexBy(std::size_t index, const F& func) const
+        {
+            if (index < schema->Count())
+            {
+                DynamicTuple::visit(schema->TypeOf(index), element(index), func);
+            }
+            else
+            {
+                throw std::out_of_range("index out of range.");
+            }
+        }
+
+        template<class F>
+        void ForEach(const F& func) const
+        {
+            for (std::size_t i = 0; i != schema->Count(); ++i)
+            {
+                IndexBy(i, func);
+            }
+        }
+    };
+}
+
+#ifdef  D_AKR_TEST
+namespace akr::test
+{
+    AKR_TEST(DynamicTuple,
+    {
+        auto s1 = (std::make_shared<const DynamicSchema>(DynamicSchema({ DynamicType::Char, DynamicType::Int64, DynamicType::Int16, DynamicType::String })));
+        AKR_CHECK(s1->Count() == 4);
+        AKR_CHECK(s1->OffsetOf(0) == 0);
+        AKR_CHECK(s1->OffsetOf(1) == 8);
+        AKR_CHECK(s1->OffsetOf(2) == 16);
+        AKR_CHECK(s1->OffsetOf(3) == 24);
+        AKR_CHECK(s1->Size() == 24 + sizeof(std::string));
+        AKR_CHECK(s1->Alignment() == alignof(std::string));
+        AKR_CHECK(!s1->IsTrivial());
+        AKR_CHECK((s1->Matches<char, std::int64_t, std::int16_t, std::string>()));
+        AKR_CHECK(!s1->Matches<char>());
+
+        auto t1 = DynamicTuple(s1);
+        AKR_CHECK(t1.Count() == 4);
+        AKR_CHECK(t1.Get<std::int64_t>(1) == 0);
+        AKR_CHECK(t1.Get<std::string>(3).empty());
+
+        t1.Get<char>(0) = 'A';
+        t1.Get<std::string>(3) = "a string that does not fit in the small buffer";
+        t1.IndexBy(1, [](auto&& e)
+        {
+            if constexpr (std::is_same_v<std::int64_t&, decltype(e)>)
+            {
+                e += 42;
+            }
+        });
+        t1.IndexBy(2, [](auto&& e)
+        {
+            if constexpr (std::is_same_v<std::int16_t&, decltype(e)>)
+            {
+                e = 7;
+            }
+        });
+        AKR_CHECK(t1.Get<std::int64_t>(1) == 42);
+        AKR_CHECK(t1.Get<std::int16_t>(2) == 7);
+
+        auto count = 0;
+        std::as_const(t1).ForEach([&](auto&&) { ++count; });
+        AKR_CHECK(count == 4);
+
+        auto thrown = 0;
+        try
+        {
+            t1.Get<int>(1);
+        }
+        catch (const std::invalid_argument&)
+        {
+            ++thrown;
+        }
+        try
+        {
+            t1.IndexBy(4, [](auto&&) {});
+        }
+        catch (const std::out_of_range&)
+        {
+            ++thrown;
+        }
+        try
+        {
+            (t1.To<char, std::int64_t>());
+        }
+        catch (const std::invalid_argument&)
+        {
+            ++thrown;
+        }
+        AKR_CHECK(thrown == 3);
+
+        auto t2 = t1;
+        t2.Get<std::string>(3) += "!";
+        AKR_CHECK(t1.Get<std::string>(3).back() == 'r');
+        AKR_CHECK(t2.Get<std::string>(3).back() == '!');
+
+        auto t3 = std::move(t2);
+        AKR_CHECK(std::as_const(t2).Get<std::string>(3).empty());
+        AKR_CHECK(std::as_const(t2).Get<char>(0) == 0);
+        auto t6 = std::as_const(t2);
+        AKR_CHECK(std::as_const(t6).To<char, std::int64_t, std::int16_t, std::string>().IndexOf<3>().empty());
+        t6.Get<std::int64_t>(1) = 9;
+        AKR_CHECK(t6.Get<std::int64_t>(1) == 9);
+        AKR_CHECK(t6.Get<std::string>(3).empty());
+        t2.IndexBy(3, [](auto&& e)
+        {
+            if constexpr (std::is_same_v<std::string&, decltype(e)>)
+            {
+                e = "refilled";
+            }
+        });
+        AKR_CHECK(t2.Get<std::string>(3) == "refilled");
+
+        t1 = t3;
+        AKR_CHECK(t1.Get<std::string>(3).back() == '!');
+
+        auto typed = t1.To<char, std::int64_t, std::int16_t, std::string>();
+        AKR_CHECK(typed.IndexOf<0>() == 'A');
+        AKR_CHECK(typed.IndexOf<1>() == 42);
+        AKR_CHECK(typed.IndexOf<3>() == t1.Get<std::string>(3));
+
+        auto t4 = DynamicTuple(Tuple(1.5, 2u, true));
+        AKR_CHECK((&t4.Schema() == DynamicSchema::Of<double, unsigned, bool>().get()));
+        AKR_CHECK(t4.Schema().IsTrivial());
+        AKR_CHECK(t4.Get<double>(0) == 1.5);
+        AKR_CHECK(t4.Get<bool>(2));
+
+        auto t5 = t4;
+        AKR_CHECK((t5.To<double, unsigned, bool>().IndexOf<1>() == 2));
+    });
+}
+#endif//D_AKR_TEST
+
+#endif//Z_AKR_DYNAMIC_TUPLE_HH
@@ -0,0 +1,279 @@
+#ifndef Z_AKR_LAZY_TUPLE_HH
+#define Z_AKR_LAZY_TUPLE_HH
+
+#include "tuple.hh"
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <optional>
+
+namespace akr
+{
+    template<class F>
+    requires(std::is_invocable_v<F&> && !std::is_void_v<std::invoke_result_t<F&>>)
+    struct Lazy final
+    {
+        public:
+        using Type = std::decay_t<std::invoke_result_t<F&>>;
+
+        F func;
+    };
+
+    template<class F>
+    Lazy(F) -> Lazy<F>;
+
+    template<class T, bool S>
+    struct LazyTupleElement final
+    {
+        public:
+        using Type = T;
+
+        private:
+        T value {};
+
+        public:
+        constexpr LazyTupleElement() = default;
+
+        template<class V>
+        requires(!std::is_same_v<std::remove_cvref_t<V>, LazyTupleElement>)
+        explicit constexpr LazyTupleElement(V&& value_)
+            noexcept(std::is_nothrow_constructible_v<T, V&&>):
+            value { std::forward<V>(value_) }
+        {
+        }
+
+        public:
+        constexpr auto Get()       noexcept ->       T&
+        {
+            return value;
+        }
+
+        constexpr auto Get() const noexcept -> const T&
+        {
+            return value;
+        }
+
+        constexpr auto IsComputed() const noexcept -> bool
+        {
+            return true;
+        }
+    };
+
+    template<class F, bool S>
+    struct LazyTupleElement<Lazy<F>, S> final
+    {
+        public:
+        using Type = typename Lazy<F>::Type;
+
+        private:
+        struct None final {};
+
+        mutable F func;
+
+        mutable std::optional<Type> value {};
+
+        [[no_unique_address]] mutable std::conditional_t<S, std::once_flag, None> flag {};
+
+        [[no_unique_address]] mutable std::conditional_t<S, std::atomic<bool>, None> done {};
+
+        public:
+        template<class V>
+        requires(std::is_same_v<std::remove_cvref_t<V>, Lazy<F>>)
+        explicit constexpr LazyTupleElement(V&& value_)
+            noexcept(std::is_nothrow_constructible_v<F, decltype((std::forward<V>(value_).func))>):
+            func { std::forward<V>(value_).func }
+        {
+        }
+
+        public:
+        constexpr auto Get() const -> Type&
+        {
+            if constexpr (S)
+            {
+                if (!done.load(std::memory_order_acquire))
+                {
+                    std::call_once(flag, [this]()
+                    {
+                        value.emplace(std::invoke(func));
+
+                        done.store(true, std::memory_order_release);
+                    });
+                }
+            }
+            else
+            {
+                if (!value)
+                {
+                    value.emplace(std::invoke(func));
+                }
+            }
+
+            return *value;
+        }
+
+        constexpr auto IsComputed() const noexcept -> bool
+        {
+            if constexpr (S)
+            {
+                return done.load(std::memory_order_acquire);
+            }
+            else
+            {
+                return value.has_value();
+            }
+        }
+    };
+
+    template<bool S, class... T>
+    struct BasicLazyTuple
+    {
+        private:
+        Tuple<LazyTupleElement<T, S>...> elements;
+
+        public:
+        static constexpr auto Count = sizeof...(T);
+
+        template<std::size_t I>
+        requires(I < Count)
+        using ElementType = typename TupleHelper<Tuple<LazyTupleElement<T, S>...>>::template ElementType<I>::Type;
+
+        public:
+        template<class... V>
+        requires(sizeof...(V) == Count && !(Count == 1 && (... && std::is_base_of_v<BasicLazyTuple, std::remove_cvref_t<V>>)))
+        explicit constexpr BasicLazyTuple(V&&... values)
+            noexcept((... && std::is_nothrow_constructible_v<LazyTupleElement<T, S>, V&&>)):
+            elements(std::forward<V>(values)...)
+        {
+        }
+
+        public:
+        template<class F>
+        constexpr void ForEach(const F& func)
+        {
+            elements.ForEach([&](auto&& e) constexpr { func(e.Get()); });
+        }
+
+        template<class F>
+        constexpr void IndexBy(std::size_t index, const F& func)
+        {
+            elements.IndexBy(index, [&](auto&& e) constexpr { func(e.Get()); });
+        }
+
+        template<std::size_t I>
+        requires(I < Count)
+        constexpr auto IndexOf()       ->       ElementType<I>&
+        {
+            return elements.template IndexOf<I>().Get();
+        }
+
+        public:
+        template<class F>
+        constexpr void ForEach(const F& func) const
+        {
+            elements.ForEach([&](auto&& e) constexpr { func(std::as_const(e.Get())); });
+        }
+
+        template<class F>
+        constexpr void IndexBy(std::size_t index, const F& func) const
+        {
+            elements.IndexBy(index, [&](auto&& e) constexpr { func(std::as_const(e.Get())); });
+        }
+
+        template<std::size_t I>
+        requires(I < Count)
+        constexpr auto IndexOf() const -> const ElementType<I>&
+        {
+            return elements.template IndexOf<I>().Get();
+        }
+
+        template<std::size_t I>
+        requires(I < Count)
+        constexpr auto IsComputed() const noexcept -> bool
+        {
+            return elements.template IndexOf<I>().IsComputed();
+        }
+    };
+
+    template<class... T>
+    struct LazyTuple final: BasicLazyTuple<false, T...>
+    {
+        public:
+        using BasicLazyTuple<false, T...>::BasicLazyTuple;
+    };
+
+    template<class... T>
+    struct SyncLazyTuple final: BasicLazyTuple<true , T...>
+    {
+        public:
+        using BasicLazyTuple<true , T...>::BasicLazyTuple;
+    };
+
+    template<class V, class... W>
+    explicit LazyTuple    (V&& value_, W&&... values) -> LazyTuple    <std::decay_t<V>, std::decay_t<W>...>;
+
+    template<class V, class... W>
+    explicit SyncLazyTuple(V&& value_, W&&... values) -> SyncLazyTuple<std::decay_t<V>, std::decay_t<W>...>;
+}
+
+#ifdef  D_AKR_TEST
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace akr::test
+{
+    AKR_TEST(LazyTuple,
+    {
+        auto calls = 0;
+
+        auto t1 = LazyTuple(1, Lazy([&]() { ++calls; return std::string("ABC"); }), Lazy([&]() { ++calls; return 3.14; }));
+        static_assert(t1.Count == 3);
+        static_assert(std::is_same_v<std::string&, decltype(t1.IndexOf<1>())>);
+        static_assert(std::is_same_v<const double&, decltype(std::as_const(t1).IndexOf<2>())>);
+        AKR_CHECK(calls == 0);
+        AKR_CHECK( t1.IsComputed<0>());
+        AKR_CHECK(!t1.IsComputed<1>());
+
+        AKR_CHECK(t1.IndexOf<1>() == "ABC");
+        AKR_CHECK(t1.IndexOf<1>() == "ABC");
+        AKR_CHECK(calls == 1);
+        AKR_CHECK( t1.IsComputed<1>());
+        AKR_CHECK(!t1.IsComputed<2>());
+
+        t1.IndexOf<1>() += "D";
+        AKR_CHECK(std::as_const(t1).IndexOf<1>() == "ABCD");
+
+        t1.IndexBy(0, [](auto&& e) { e = 2; });
+        AKR_CHECK(t1.IndexOf<0>() == 2);
+        AKR_CHECK(calls == 1);
+
+        auto visited = 0;
+        t1.ForEach([&](auto&&) { ++visited; });
+        AKR_CHECK(visited == 3);
+        AKR_CHECK(calls == 2);
+        AKR_CHECK(t1.IsComputed<2>());
+
+        auto forced = 0;
+        auto s1 = SyncLazyTuple(Lazy([&]() { return ++forced; }), 7);
+        AKR_CHECK(!s1.IsComputed<0>());
+
+        auto threads = std::vector<std::thread>();
+        auto sum     = std::atomic<int>();
+        for (auto i = 0; i != 4; ++i)
+        {
+            threads.emplace_back([&]() { sum += std::as_const(s1).IndexOf<0>(); });
+        }
+        for (auto&& thread : threads)
+        {
+            thread.join();
+        }
+        AKR_CHECK(forced == 1);
+        AKR_CHECK(sum == 4);
+        AKR_CHECK(s1.IsComputed<0>());
+        AKR_CHECK(s1.IndexOf<1>() == 7);
+    });
+}
+#endif//D_AKR_TEST
+
+#endif//Z_AKR_LAZY_TUPLE_HH
@@ -0,0 +1,140 @@
+#ifndef Z_AKR_PADDED_TUPLE_HH
+#define Z_AKR_PADDED_TUPLE_HH
+
+#include "tuple.hh"
+
+#include <new>
+
+namespace akr
+{
+    #ifdef __cpp_lib_hardware_interference_size
+    #if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Winterference-size"
+    #endif
+    inline constexpr std::size_t PaddedTupleAlignment = std::hardware_destructive_interference_size;
+    #if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic pop
+    #endif
+    #else
+    inline constexpr std::size_t PaddedTupleAlignment = 64;
+    #endif
+
+    template<class T>
+    struct alignas(PaddedTupleAlignment) PaddedTupleElement final
+    {
+        public:
+        T value {};
+    };
+
+    template<class... T>
+    struct PaddedTuple final
+    {
+        private:
+        Tuple<PaddedTupleElement<T>...> elements {};
+
+        public:
+        static constexpr auto Count = sizeof...(T);
+
+        public:
+        constexpr PaddedTuple() = default;
+
+        template<class... V>
+        requires(sizeof...(V) == Count && Count != 0)
+        explicit constexpr PaddedTuple(V&&... values)
+            noexcept((... && std::is_nothrow_constructible_v<T, V&&>)):
+            elements(PaddedTupleElement<T> { std::forward<V>(values) }...)
+        {
+        }
+
+        public:
+        template<class F>
+        constexpr void ForEach(const F& func)
+            noexcept((... && noexcept(func(std::declval<T&>()))))
+        {
+            elements.ForEach([&](auto&& e) constexpr { func(e.value); });
+        }
+
+        template<class F>
+        constexpr void IndexBy(std::size_t index, const F& func)
+        {
+            elements.IndexBy(index, [&](auto&& e) constexpr { func(e.value); });
+        }
+
+        template<std::size_t I>
+        requires(I < Count)
+        constexpr auto IndexOf()       noexcept ->       auto&
+        {
+            return elements.template IndexOf<I>().value;
+        }
+
+        public:
+        template<class F>
+        constexpr void ForEach(const F& func) const
+            noexcept((... && noexcept(func(std::declval<const T&>()))))
+        {
+            elements.ForEach([&](auto&& e) constexpr { func(e.value); });
+        }
+
+        template<class F>
+        constexpr void IndexBy(std::size_t index, const F& func) const
+        {
+            elements.IndexBy(index, [&](auto&& e) constexpr { func(e.value); });
+        }
+
+        template<std::size_t I>
+        requires(I < Count)
+        constexpr auto IndexOf() const noexcept -> const auto&
+        {
+            return elements.template IndexOf<I>().value;
+        }
+    };
+
+    template<class V, class... W>
+    explicit PaddedTuple(V&& value_, W&&... values) -> PaddedTuple<std::decay_t<V>, std::decay_t<W>...>;
+}
+
+#ifdef  D_AKR_TEST
+#include <atomic>
+
+namespace akr::test
+{
+    AKR_TEST(PaddedTuple,
+    {
+        static_assert(sizeof(PaddedTuple<char>) == PaddedTupleAlignment);
+        static_assert(sizeof(decltype(PaddedTuple(1, 'A', 3.14))) == PaddedTupleAlignment * 3);
+        static_assert(alignof(decltype(PaddedTuple(1, 'A', 3.14))) == PaddedTupleAlignment);
+
+        static_assert(PaddedTuple(1, 2).IndexOf<1>() == 2);
+
+        auto p1 = PaddedTuple(1, 'A', 3.14);
+        static_assert(p1.Count == 3);
+        static_assert(std::is_same_v<char&, decltype(p1.IndexOf<1>())>);
+        AKR_CHECK(p1.IndexOf<0>() == 1);
+        AKR_CHECK(p1.IndexOf<1>() == 'A');
+        AKR_CHECK(p1.IndexOf<2>() == 3.14);
+
+        auto distance = reinterpret_cast<const char*>(&p1.IndexOf<1>()) - reinterpret_cast<const char*>(&p1.IndexOf<0>());
+        AKR_CHECK(static_cast<std::size_t>(distance < 0 ? -distance : distance) >= PaddedTupleAlignment);
+
+        p1.IndexBy(1, [](auto&& e) { e = 'B'; });
+        AKR_CHECK(p1.IndexOf<1>() == 'B');
+
+        auto count = 0;
+        p1.ForEach([&](auto&&) { ++count; });
+        AKR_CHECK(count == 3);
+
+        using P2 = PaddedTuple<std::atomic<int>, std::atomic<int>>;
+
+        auto p2 = P2();
+        p2.IndexOf<0>().fetch_add(1);
+        p2.ForEach([](auto&& e) { e.fetch_add(2); });
+        AKR_CHECK(p2.IndexOf<0>() == 3);
+        AKR_CHECK(p2.IndexOf<1>() == 2);
+        AKR_CHECK(reinterpret_cast<const char*>(&p2.IndexOf<1>()) - reinterpret_cast<const char*>(&p2.IndexOf<0>())
+               == static_cast<std::ptrdiff_t>(PaddedTupleAlignment));
+    });
+}
+#endif//D_AKR_TEST
+
+#endif//Z_AKR_PADDED_TUPLE_HH
@@ -0,0 +1,206 @@
+#ifndef Z_AKR_SHARED_TUPLE_HH
+#define Z_AKR_SHARED_TUPLE_HH
+
+#include "tuple.hh"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+namespace akr
+{
+    template<class... T>
+    requires(std::is_trivially_copyable_v<Tuple<T...>>)
+    struct SharedTuple final
+    {
+        private:
+        using Word = std::uint64_t;
+
+        inline static constexpr std::size_t Count = (sizeof(Tuple<T...>) + sizeof(Word) - 1) / sizeof(Word);
+
+        alignas(64) std::atomic<Word> sequence {};
+
+        std::atomic<Word> words[Count] {};
+
+        public:
+        SharedTuple() noexcept
+        {
+            write(Tuple<T...>());
+        }
+
+        explicit SharedTuple(const Tuple<T...>& value) noexcept
+        {
+            write(value);
+        }
+
+        SharedTuple(const SharedTuple&) = delete;
+
+        public:
+        auto operator=(const SharedTuple&) -> SharedTuple& = delete;
+
+        public:
+        auto Load() const noexcept -> Tuple<T...>
+        {
+            Word buffer[Count];
+
+            while (true)
+            {
+                auto before = sequence.load(std::memory_order_acquire);
+
+                if (before & 1)
+                {
+                    continue;
+                }
+
+                for (std::size_t i = 0; i != Count; ++i)
+                {
+                    buffer[i] = words[i].load(std::memory_order_relaxed);
+                }
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                if (sequence.load(std::memory_order_relaxed) == before)
+                {
+                    break;
+                }
+            }
+
+            auto value = Tuple<T...>();
+
+            std::memcpy(static_cast<void*>(&value), buffer, sizeof(Tuple<T...>));
+
+            return value;
+        }
+
+        void Store(const Tuple<T...>& value) noexcept
+        {
+            auto before = lock();
+
+            write(value);
+
+            sequence.store(before + 2, std::memory_order_release);
+        }
+
+        template<class F>
+        auto Update(const F& func) noexcept(noexcept(func(std::declval<const Tuple<T...>&>()))) -> Tuple<T...>
+        {
+            auto before = lock();
+
+            auto value = Tuple<T...>(func(static_cast<const Tuple<T...>&>(read())));
+
+            write(value);
+
+            sequence.store(before + 2, std::memory_order_release);
+
+            return value;
+        }
+
+        private:
+        auto lock() noexcept -> Word
+        {
+            auto before = sequence.load(std::memory_order_relaxed);
+
+            while ((before & 1) || !sequence.compare_exchange_weak(before, before + 1, std::memory_order_relaxed))
+            {
+                before = sequence.load(std::memory_order_relaxed);
+            }
+
+            std::atomic_thread_fence(std::memory_order_release);
+
+            return before;
+        }
+
+        auto read() const noexcept -> Tuple<T...>
+        {
+            Word buffer[Count];
+
+            for (std::size_t i = 0; i != Count; ++i)
+            {
+                buffer[i] = words[i].load(std::memory_order_relaxed);
+            }
+
+            auto value = Tuple<T...>();
+
+            std::memcpy(static_cast<void*>(&value), buffer, sizeof(Tuple<T...>));
+
+            return value;
+        }
+
+        void write(const Tuple<T...>& value) noexcept
+        {
+            Word buffer[Count] {};
+
+            std::memcpy(buffer, static_cast<const void*>(&value), sizeof(Tuple<T...>));
+
+            for (std::size_t i = 0; i != Count; ++i)
+            {
+                words[i].store(buffer[i], std::memory_order_relaxed);
+            }
+        }
+    };
+
+    template<class... T>
+    explicit SharedTuple(const Tuple<T...>& value) -> SharedTuple<T...>;
+}
+
+#ifdef  D_AKR_TEST
+#include <thread>
+#include <vector>
+
+namespace akr::test
+{
+    AKR_TEST(SharedTuple,
+    {
+        static_assert(alignof(SharedTuple<char>) == 64);
+
+        auto s1 = SharedTuple(Tuple(1, 'A', 3.14));
+        AKR_CHECK(s1.Load().IndexOf<0>() == 1);
+        AKR_CHECK(s1.Load().IndexOf<1>() == 'A');
+        AKR_CHECK(s1.Load().IndexOf<2>() == 3.14);
+
+        s1.Store(Tuple(2, 'B', 2.71));
+        AKR_CHECK(s1.Load().IndexOf<0>() == 2);
+        AKR_CHECK(s1.Load().IndexOf<2>() == 2.71);
+
+        auto u1 = s1.Update([](auto&& e) { return Tuple(e.template IndexOf<0>() + 1, 'C', 0.0); });
+        AKR_CHECK(u1.IndexOf<0>() == 3);
+        AKR_CHECK(s1.Load().IndexOf<1>() == 'C');
+
+        using T2 = decltype(Tuple(0ll, 0ll, 0ll, 0ll, 0ll));
+
+        auto s2 = SharedTuple(T2());
+
+        auto done    = std::atomic<bool>();
+        auto readers = std::vector<std::thread>();
+
+        for (auto i = 0; i != 2; ++i)
+        {
+            readers.emplace_back([&]()
+            {
+                while (!done.load(std::memory_order_relaxed))
+                {
+                    auto value = s2.Load();
+
+                    value.ForEach([&](auto&& e) { AKR_CHECK(e == value.template IndexOf<0>()); });
+                }
+            });
+        }
+
+        for (auto i = 1ll; i != 20000; ++i)
+        {
+            s2.Store(T2(i, i, i, i, i));
+        }
+
+        done = true;
+
+        for (auto&& reader : readers)
+        {
+            reader.join();
+        }
+
+        AKR_CHECK(s2.Load().IndexOf<4>() == 19999);
+    });
+}
+#endif//D_AKR_TEST
+
+#endif//Z_AKR_SHARED_TUPLE_HH
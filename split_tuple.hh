@@ -0,0 +1,419 @@
+#ifndef Z_AKR_SPLIT_TUPLE_HH
+#define Z_AKR_SPLIT_TUPLE_HH
+
+#include "tuple.hh"
+
+#include <new>
+
+namespace akr
+{
+    template<class... T>
+    struct Hot  final {};
+
+    template<class... T>
+    struct Cold final {};
+
+    template<class T>
+    struct SplitTuplePool final
+    {
+        private:
+        struct Node final
+        {
+            public:
+            Node* next;
+        };
+
+        struct Cache final
+        {
+            public:
+            Node* head;
+
+            std::size_t size;
+
+            bool closed;
+        };
+
+        // Frees the cached blocks at thread exit and closes the cache, so blocks released by SplitTuples that are
+        // destroyed later (thread_local or static ones) go straight back to operator delete.
+        struct Drain final
+        {
+            public:
+            ~Drain()
+            {
+                auto&& cache = SplitTuplePool::cache();
+
+                cache.closed = true;
+
+                while (cache.head)
+                {
+                    ::operator delete(std::exchange(cache.head, cache.head->next), Size, std::align_val_t(Alignment));
+                }
+
+                cache.size = 0;
+            }
+        };
+
+        inline static constexpr std::size_t Size      = sizeof (T) < sizeof (Node) ? sizeof (Node) : sizeof (T);
+
+        inline static constexpr std::size_t Alignment = alignof(T) < alignof(Node) ? alignof(Node) : alignof(T);
+
+        inline static constexpr std::size_t Capacity  = 64;
+
+        // Trivially destructible, so it stays usable after the thread's Drain has run.
+        static auto cache() noexcept -> Cache&
+        {
+            constinit thread_local auto cache = Cache { nullptr, 0, false };
+
+            return cache;
+        }
+
+        public:
+        static auto Allocate() -> void*
+        {
+            auto&& cache = SplitTuplePool::cache();
+
+            if (cache.head)
+            {
+                --cache.size;
+
+                return std::exchange(cache.head, cache.head->next);
+            }
+
+            return ::operator new(Size, std::align_val_t(Alignment));
+        }
+
+        static void Deallocate(void* block) noexcept
+        {
+            auto&& cache = SplitTuplePool::cache();
+
+            if (cache.closed || cache.size == Capacity)
+            {
+                ::operator delete(block, Size, std::align_val_t(Alignment));
+            }
+            else
+            {
+                thread_local auto drain = Drain();
+
+                static_cast<void>(drain);
+
+                ++cache.size;
+
+                cache.head = ::new (block) Node { cache.head };
+            }
+        }
+    };
+
+    template<class H, class C>
+    struct SplitTuple;
+
+    template<class... H, class... C>
+    requires(sizeof...(H) != 0 && sizeof...(C) != 0)
+    struct SplitTuple<Hot<H...>, Cold<C...>> final
+    {
+        public:
+        static constexpr auto Count = sizeof...(H) + sizeof...(C);
+
+        static constexpr auto HotCount = sizeof...(H);
+
+        template<std::size_t I>
+        requires(I < Count)
+        using ElementType = typename TupleHelper<Tuple<H..., C...>>::template ElementType<I>;
+
+        private:
+        using Pool = SplitTuplePool<Tuple<C...>>;
+
+        Tuple<H...> hot {};
+
+        Tuple<C...>* cold;
+
+        template<class... V>
+        static auto create(V&&... values) -> Tuple<C...>*
+        {
+            auto block = Pool::Allocate();
+
+            try
+            {
+                return ::new (block) Tuple<C...>(std::forward<V>(values)...);
+            }
+            catch (...)
+            {
+                Pool::Deallocate(block);
+
+                throw;
+            }
+        }
+
+        public:
+        SplitTuple():
+            cold { create() }
+        {
+        }
+
+        template<class V1, class V2>
+        requires(TupleHelper<V1>::IsTuple && TupleHelper<V1>::CountOf() == sizeof...(H)
+              && TupleHelper<V2>::IsTuple && TupleHelper<V2>::CountOf() == sizeof...(C))
+        explicit SplitTuple(V1&& hot_, V2&& cold_):
+            hot(std::forward<V1>(hot_)),
+            cold { create(std::forward<V2>(cold_)) }
+        {
+        }
+
+        SplitTuple(const SplitTuple& rhs):
+            hot(rhs.hot),
+            cold { rhs.cold ? create(*rhs.cold) : nullptr }
+        {
+        }
+
+        // Takes over rhs's cold block. A moved-from SplitTuple reads its cold elements as default-constructed and
+        // allocates a fresh block on its first mutable access.
+        SplitTuple(SplitTuple&& rhs) noexcept(std::is_nothrow_move_constructible_v<Tuple<H...>>):
+            hot(std::move(rhs.hot)),
+            cold { std::exchange(rhs.cold, nullptr) }
+        {
+        }
+
+        ~SplitTuple()
+        {
+            if (cold)
+            {
+                cold->~Tuple<C...>();
+
+                Pool::Deallocate(cold);
+            }
+        }
+
+        public:
+        auto operator=(const SplitTuple& rhs) -> SplitTuple&
+        {
+            if (this != &rhs)
+            {
+                if (cold && rhs.cold)
+                {
+                    *cold = *rhs.cold;
+
+                    hot = rhs.hot;
+                }
+                else
+                {
+                    *this = SplitTuple(rhs);
+                }
+            }
+
+            return *this;
+        }
+
+        auto operator=(SplitTuple&& rhs) noexcept(std::is_nothrow_move_assignable_v<Tuple<H...>>) -> SplitTuple&
+        {
+            hot = std::move(rhs.hot);
+
+            std::swap(cold, rhs.cold);
+
+            return *this;
+        }
+
+        public:
+        template<class F>
+        void ForEach(const F& func)
+        {
+            hot.ForEach(func);
+
+            coldPart().ForEach(func);
+        }
+
+        template<class F>
+        void IndexBy(std::size_t index, const F& func)
+        {
+            if (index < HotCount)
+            {
+                hot.IndexBy(index, func);
+            }
+            else
+            {
+                coldPart().IndexBy(index - HotCount, func);
+            }
+        }
+
+        template<std::size_t I>
+        requires(I < Count)
+        auto IndexOf()       noexcept(I < HotCount) ->       ElementType<I>&
+        {
+            if constexpr (I < HotCount)
+            {
+                return hot.template IndexOf<I>();
+            }
+            else
+            {
+                return coldPart().template IndexOf<I - HotCount>();
+            }
+        }
+
+        auto HotPart()       noexcept ->       Tuple<H...>&
+        {
+            return hot;
+        }
+
+        auto ColdPart()       ->       Tuple<C...>&
+        {
+            return coldPart();
+        }
+
+        public:
+        template<class F>
+        void ForEach(const F& func) const
+        {
+            hot.ForEach(func);
+
+            coldPart().ForEach(func);
+        }
+
+        template<class F>
+        void IndexBy(std::size_t index, const F& func) const
+        {
+            if (index < HotCount)
+            {
+                hot.IndexBy(index, func);
+            }
+            else
+            {
+                coldPart().IndexBy(index - HotCount, func);
+            }
+        }
+
+        template<std::size_t I>
+        requires(I < Count)
+        auto IndexOf() const noexcept(I < HotCount || NothrowEmpty) -> const ElementType<I>&
+        {
+            if constexpr (I < HotCount)
+            {
+                return hot.template IndexOf<I>();
+            }
+            else
+            {
+                return coldPart().template IndexOf<I - HotCount>();
+            }
+        }
+
+        auto HotPart() const noexcept -> const Tuple<H...>&
+        {
+            return hot;
+        }
+
+        auto ColdPart() const noexcept(NothrowEmpty) -> const Tuple<C...>&
+        {
+            return coldPart();
+        }
+
+        private:
+        static constexpr auto NothrowEmpty = std::is_nothrow_default_constructible_v<Tuple<C...>>;
+
+        auto coldPart() -> Tuple<C...>&
+        {
+            if (!cold)
+            {
+                cold = create();
+            }
+
+            return *cold;
+        }
+
+        auto coldPart() const noexcept(NothrowEmpty) -> const Tuple<C...>&
+        {
+            if (!cold)
+            {
+                static const auto empty = Tuple<C...>();
+
+                return empty;
+            }
+
+            return *cold;
+        }
+    };
+
+    template<class... H, class... C>
+    explicit SplitTuple(const Tuple<H...>& hot_, const Tuple<C...>& cold_) -> SplitTuple<Hot<H...>, Cold<C...>>;
+
+    template<class... H, class... C>
+    explicit SplitTuple(      Tuple<H...>&& hot_,       Tuple<C...>&& cold_) -> SplitTuple<Hot<H...>, Cold<C...>>;
+}
+
+#ifdef  D_AKR_TEST
+#include <string>
+#include <thread>
+
+namespace akr::test
+{
+    AKR_TEST(SplitTuple,
+    {
+        auto t1 = SplitTuple(Tuple(1, 2u), Tuple(std::string("ABC"), 3.14));
+        static_assert(t1.Count == 4);
+        static_assert(t1.HotCount == 2);
+        static_assert(sizeof(t1) == sizeof(Tuple(1, 2u)) + sizeof(void*));
+        static_assert(std::is_same_v<std::string&, decltype(t1.IndexOf<2>())>);
+        AKR_CHECK(t1.IndexOf<0>() == 1);
+        AKR_CHECK(t1.IndexOf<1>() == 2);
+        AKR_CHECK(t1.IndexOf<2>() == "ABC");
+        AKR_CHECK(t1.IndexOf<3>() == 3.14);
+
+        t1.IndexBy(2, [](auto&& e) { e += e; });
+        AKR_CHECK(t1.IndexOf<2>() == "ABCABC");
+
+        auto count = 0;
+        t1.ForEach([&](auto&&) { ++count; });
+        AKR_CHECK(count == 4);
+
+        auto t2 = t1;
+        AKR_CHECK(&t2.ColdPart() != &t1.ColdPart());
+        AKR_CHECK(t2.IndexOf<2>() == "ABCABC");
+
+        auto* cold = &t1.ColdPart();
+        auto t3 = std::move(t1);
+        AKR_CHECK(&t3.ColdPart() == cold);
+        AKR_CHECK(t3.IndexOf<3>() == 3.14);
+
+        AKR_CHECK(std::as_const(t1).IndexOf<2>().empty());
+        AKR_CHECK(std::as_const(t1).IndexOf<0>() == 1);
+        auto t6 = t1;
+        AKR_CHECK(t6.IndexOf<2>().empty());
+        t1.IndexOf<3>() = 1.5;
+        AKR_CHECK(t1.IndexOf<3>() == 1.5);
+        AKR_CHECK(&t1.ColdPart() != cold);
+        static_assert(!noexcept(t1.IndexOf<2>()) && noexcept(t1.IndexOf<0>()));
+
+        t1 = t2;
+        AKR_CHECK(std::as_const(t1).IndexOf<2>() == "ABCABC");
+
+        t2.IndexOf<0>() = 5;
+        t1 = std::move(t2);
+        AKR_CHECK(t1.IndexOf<0>() == 5);
+
+        auto thrown = false;
+        try
+        {
+            t1.IndexBy(4, [](auto&&) {});
+        }
+        catch (const std::out_of_range&)
+        {
+            thrown = true;
+        }
+        AKR_CHECK(thrown);
+
+        using S1 = decltype(t1);
+        auto* block = static_cast<const void*>(&S1().ColdPart());
+        auto t4 = S1();
+        AKR_CHECK(static_cast<const void*>(&t4.ColdPart()) == block);
+        AKR_CHECK(t4.IndexOf<2>().empty());
+
+        auto worker = std::thread([]()
+        {
+            thread_local auto t5 = S1();
+
+            static_cast<void>(S1());
+
+            t5.IndexOf<2>() = "ABC";
+        });
+        worker.join();
+    });
+}
+#endif//D_AKR_TEST
+
+#endif//Z_AKR_SPLIT_TUPLE_HH
@@ -5,18 +5,260 @@
 #include <cassert>
 
 #ifdef  D_AKR_TEST
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace akr::test
+{
+    struct Registry final
+    {
+        private:
+        struct Entry final
+        {
+            public:
+            const char* name;
+
+            void (*func)();
+        };
+
+        struct Current final
+        {
+            public:
+            const char* name = nullptr;
+
+            std::size_t failures = 0;
+        };
+
+        static auto entries() noexcept -> std::vector<Entry>&
+        {
+            static auto entries = std::vector<Entry>();
+
+            return entries;
+        }
+
+        static auto current() noexcept -> Current&
+        {
+            thread_local auto current = Current();
+
+            return current;
+        }
+
+        // Failed checks made on threads a test started itself, which cannot be attributed to one test.
+        static auto strays() noexcept -> std::atomic<std::size_t>&
+        {
+            static auto strays = std::atomic<std::size_t>(0);
+
+            return strays;
+        }
+
+        static auto matches(std::string_view name, const std::vector<std::string_view>& filters) noexcept -> bool
+        {
+            return filters.empty() || std::any_of(filters.begin(), filters.end(), [&](std::string_view filter)
+            {
+                return filter.ends_with('*') ? name.starts_with(filter.substr(0, filter.size() - 1)) : name == filter;
+            });
+        }
+
+        static auto usage(const char* program) noexcept -> int
+        {
+            std::fprintf(stderr, "usage: %s [--list] [-j N] [Name | Prefix*]...\n", program);
+
+            return EXIT_FAILURE;
+        }
+
+        public:
+        static auto Add(const char* name, void (*func)()) -> int
+        {
+            entries().push_back({ name, func });
+
+            return 0;
+        }
+
+        // Records a failed AKR_CHECK and lets the test continue, so one failure neither aborts the run nor hides the
+        // others, and checks do not depend on NDEBUG.
+        static void Fail(const char* expression, const char* file, int line) noexcept
+        {
+            auto&& test = Registry::current();
+
+            if (test.name)
+            {
+                ++test.failures;
+            }
+            else
+            {
+                ++Registry::strays();
+            }
+
+            std::printf("[CHECK] %s:%d: %s failed in %s\n", file, line, expression, test.name ? test.name : "a test thread");
+        }
+
+        // Usage: <binary> [--list] [-j N] [Name | Prefix*]...
+        static auto Run(int argc, char* argv[]) -> int
+        {
+            auto filters  = std::vector<std::string_view>();
+            auto jobs     = std::max(1u, std::thread::hardware_concurrency());
+            auto listOnly = false;
+
+            for (auto i = 1; i < argc; ++i)
+            {
+                auto arg = std::string_view(argv[i]);
+
+                if (arg == "--list")
+                {
+                    listOnly = true;
+                }
+                else if (arg == "-j")
+                {
+                    if (i + 1 == argc)
+                    {
+                        return Registry::usage(argv[0]);
+                    }
+
+                    auto value = argv[++i];
+                    auto end   = value;
+
+                    jobs = std::max(1u, static_cast<unsigned>(std::strtoul(value, &end, 10)));
+
+                    if (end == value || *end != '\0')
+                    {
+                        return Registry::usage(argv[0]);
+                    }
+                }
+                else
+                {
+                    filters.push_back(arg);
+                }
+            }
+
+            auto selected = std::vector<Entry>();
+
+            std::copy_if(entries().begin(), entries().end(), std::back_inserter(selected), [&](const Entry& e)
+            {
+                return Registry::matches(e.name, filters);
+            });
+
+            if (selected.empty() && !filters.empty())
+            {
+                std::fprintf(stderr, "no test matches the given filters.\n");
+
+                return EXIT_FAILURE;
+            }
+
+            if (listOnly)
+            {
+                for (auto&& e : selected)
+                {
+                    std::printf("%s\n", e.name);
+                }
+
+                return EXIT_SUCCESS;
+            }
+
+            auto next   = std::atomic<std::size_t>(0);
+            auto failed = std::atomic<std::size_t>(0);
+            auto mutex  = std::mutex();
+            auto begin  = std::chrono::steady_clock::now();
+
+            auto worker = [&]()
+            {
+                for (auto i = next++; i < selected.size(); i = next++)
+                {
+                    auto&& entry = selected[i];
+                    auto   start = std::chrono::steady_clock::now();
+                    auto   error = static_cast<const char*>(nullptr);
+
+                    Registry::current() = { entry.name, 0 };
+
+                    try
+                    {
+                        entry.func();
+                    }
+                    catch (const std::exception& e)
+                    {
+                        error = e.what();
+                    }
+                    catch (...)
+                    {
+                        error = "unknown exception.";
+                    }
+
+                    auto elapsed  = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+                    auto failures = std::exchange(Registry::current(), Current()).failures;
+
+                    auto lock = std::lock_guard(mutex);
+
+                    if (error)
+                    {
+                        ++failed;
+
+                        std::printf("[FAIL] %-24s %10.3f ms  %s\n", entry.name, elapsed, error);
+                    }
+                    else if (failures)
+                    {
+                        ++failed;
+
+                        std::printf("[FAIL] %-24s %10.3f ms  %zu failed check(s).\n", entry.name, elapsed, failures);
+                    }
+                    else
+                    {
+                        std::printf("[ OK ] %-24s %10.3f ms\n", entry.name, elapsed);
+                    }
+                }
+            };
+
+            auto threads = std::vector<std::thread>();
+
+            for (auto i = 1u; i < std::min<std::size_t>(jobs, selected.size()); ++i)
+            {
+                threads.emplace_back(worker);
+            }
+
+            worker();
+
+            for (auto&& thread : threads)
+            {
+                thread.join();
+            }
+
+            auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+            std::printf("%zu/%zu passed in %.3f ms\n", selected.size() - failed, selected.size(), elapsed);
+
+            if (auto strays = Registry::strays().load())
+            {
+                std::printf("%zu failed check(s) on threads started by tests\n", strays);
+
+                return EXIT_FAILURE;
+            }
+
+            return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+        }
+    };
+}
+
 #define U_AKR_TEST_LINE(AKR_NAME, AKR_LINE) U_AKR_TEST_##AKR_NAME##_##AKR_LINE
 
-#define U_AKR_TEST_WITH_LINE_AND_BLOCK(AKR_NAME, AKR_LINE, AKR_BLCK) \
-        inline const auto U_AKR_TEST_LINE(AKR_NAME, AKR_LINE) = []() \
-        {                                                            \
-            AKR_BLCK;                                                \
-            return 0;                                                \
-        }();
+#define U_AKR_TEST_WITH_LINE_AND_BLOCK(AKR_NAME, AKR_LINE, ...)             \
+        inline const auto U_AKR_TEST_LINE(AKR_NAME, AKR_LINE) =             \
+            ::akr::test::Registry::Add(#AKR_NAME, []() { __VA_ARGS__; });
+
+// The block is variadic so that unparenthesized commas, as in Tuple<A, B>, need no workaround.
+#define AKR_TEST(AKR_NAME, ...) U_AKR_TEST_WITH_LINE_AND_BLOCK(AKR_NAME, __LINE__, __VA_ARGS__) // NOLINT
 
-#define AKR_TEST(AKR_NAME, AKR_BLCK) U_AKR_TEST_WITH_LINE_AND_BLOCK(AKR_NAME, __LINE__, AKR_BLCK) // NOLINT
+#define AKR_CHECK(...) \
+        ((__VA_ARGS__) ? static_cast<void>(0) : ::akr::test::Registry::Fail(#__VA_ARGS__, __FILE__, __LINE__))
 #else
-#define AKR_TEST(AKR_NAME, AKR_BLCK)
+#define AKR_TEST(AKR_NAME, ...)
 #endif
 
 #endif//Z_AKR_TEST_HH
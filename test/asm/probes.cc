@@ -0,0 +1,87 @@
+#include "../../tuple.hh"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+using Scalars = akr::Tuple<int, double, char, long>;
+
+using Packed  = akr::Tuple<int, int, int, int>;
+
+using Entry   = akr::Tuple<std::string_view, std::uint32_t, double>;
+
+// AKR_ASM probe_index_of_first 2 0 0
+extern "C" auto probe_index_of_first(const Scalars& tuple) -> int
+{
+    return tuple.IndexOf<0>();
+}
+
+// AKR_ASM probe_index_of_last 2 0 0
+extern "C" auto probe_index_of_last(const Scalars& tuple) -> long
+{
+    return tuple.IndexOf<3>();
+}
+
+// AKR_ASM probe_index_of_packed 2 0 0
+extern "C" auto probe_index_of_packed(const Packed& tuple) -> int
+{
+    return tuple.IndexOf<3>();
+}
+
+// AKR_ASM probe_index_of_store 2 0 0
+extern "C" void probe_index_of_store(Scalars& tuple, double value)
+{
+    tuple.IndexOf<1>() = value;
+}
+
+// AKR_ASM probe_for_each_scalars 16 0 0
+extern "C" auto probe_for_each_scalars(const Scalars& tuple) -> double
+{
+    auto result = 0.0;
+
+    tuple.ForEach([&](auto&& e) { result += static_cast<double>(e); });
+
+    return result;
+}
+
+// AKR_ASM probe_for_each_packed 12 0 0
+extern "C" auto probe_for_each_packed(const Packed& tuple) -> int
+{
+    auto result = 0;
+
+    tuple.ForEach([&](auto&& e) { result += e; });
+
+    return result;
+}
+
+// AKR_ASM probe_index_by_packed 6 1 0
+extern "C" void probe_index_by_packed(Packed& tuple, std::size_t index, int value)
+{
+    tuple.IndexBy(index, [&](auto&& e) { e = value; });
+}
+
+// AKR_ASM probe_index_by_scalars 24 5 0
+extern "C" void probe_index_by_scalars(Scalars& tuple, std::size_t index, int value)
+{
+    tuple.IndexBy(index, [&](auto&& e) { e = static_cast<std::remove_cvref_t<decltype(e)>>(value); });
+}
+
+// string_view keys are pointers, so this table needs load-time relocation.
+// AKR_RODATA probe_table relocated
+extern "C" constexpr auto probe_table = akr::Tuple<>::Sort<0>(std::array
+{
+    Entry(std::string_view("delta"), std::uint32_t(4), 4.5),
+    Entry(std::string_view("alpha"), std::uint32_t(1), 1.5),
+    Entry(std::string_view("gamma"), std::uint32_t(3), 3.5),
+    Entry(std::string_view("beta" ), std::uint32_t(2), 2.5),
+});
+
+// AKR_RODATA probe_concat
+extern "C" constexpr auto probe_concat = akr::Tuple<>::Concat(akr::Tuple(1, 2.5), 'A', akr::Tuple(3u)) & 4L;
+
+// AKR_ASM probe_table_lookup 6 0 0
+extern "C" auto probe_table_lookup(std::size_t index) -> std::uint32_t
+{
+    return probe_table[index].IndexOf<1>();
+}
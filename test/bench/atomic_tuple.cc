@@ -0,0 +1,60 @@
+#include "../../atomic_tuple.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using State = akr::Tuple<std::uint32_t, std::uint32_t, std::uint64_t>;
+
+static auto next(const State& state) noexcept -> State
+{
+    return State(state.IndexOf<0>() + 1, state.IndexOf<1>() | 1, state.IndexOf<2>() + 2);
+}
+
+template<class F>
+static auto measure(unsigned threads, std::size_t count, const F& func) -> double
+{
+    auto workers = std::vector<std::thread>();
+
+    auto begin = std::chrono::steady_clock::now();
+
+    for (auto i = 0u; i != threads; ++i)
+    {
+        workers.emplace_back([&]() { for (auto j = std::size_t(); j != count; ++j) { func(); } });
+    }
+
+    for (auto&& worker : workers)
+    {
+        worker.join();
+    }
+
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    return static_cast<double>(threads * count) / elapsed / 1e6;
+}
+
+int main()
+{
+    constexpr auto count = std::size_t(1) << 20;
+
+    auto maximum = std::max(1u, std::thread::hardware_concurrency());
+
+    std::printf("AtomicTuple<u32, u32, u64> lock-free: %s\n", akr::AtomicTuple<std::uint32_t, std::uint32_t,
+                std::uint64_t>::IsLockFree ? "yes" : "no (build with -mcx16)");
+    std::printf("%8s %18s %18s\n", "threads", "mutex Mops/s", "atomic Mops/s");
+
+    for (auto threads = 1u; threads <= maximum; threads *= 2)
+    {
+        auto mutex  = std::mutex();
+        auto locked = State();
+        auto atomic = akr::AtomicTuple(State());
+
+        auto m = measure(threads, count, [&]() { auto lock = std::lock_guard(mutex); locked = next(locked); });
+        auto a = measure(threads, count, [&]() { atomic.Update(next); });
+
+        std::printf("%8u %18.2f %18.2f\n", threads, m, a);
+    }
+}
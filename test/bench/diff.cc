@@ -0,0 +1,89 @@
+#include "../../tuple_diff.hh"
+
+#include <bitset>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using Record = akr::Tuple<std::uint64_t, std::uint32_t, std::uint32_t, std::int64_t, std::uint16_t, std::uint16_t, std::uint32_t>;
+
+static volatile std::size_t sink;
+
+template<class T>
+static auto naive(const T& tuple1, const T& tuple2) -> std::bitset<T::Count>
+{
+    auto diff = std::bitset<T::Count>();
+
+    [&]<std::size_t... I_>(std::index_sequence<I_...>)
+    {
+        (..., diff.set(I_, tuple1.template IndexOf<I_>() != tuple2.template IndexOf<I_>()));
+    }
+    (std::make_index_sequence<T::Count>{});
+
+    return diff;
+}
+
+template<class T, class F>
+static auto measure(const std::vector<T>& lhs, const std::vector<T>& rhs, const F& diff) -> double
+{
+    auto changed = std::size_t();
+
+    auto begin = std::chrono::steady_clock::now();
+
+    for (auto round = 0; round != 16; ++round)
+    {
+        for (auto i = std::size_t(); i != lhs.size(); ++i)
+        {
+            changed += diff(lhs[i], rhs[i]).count();
+        }
+    }
+
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    sink = changed;
+
+    return static_cast<double>(lhs.size() * 16) / elapsed / 1e6;
+}
+
+template<class T>
+static void run(const char* name, double ratio)
+{
+    constexpr auto count = std::size_t(1) << 20;
+
+    auto engine = std::mt19937_64(42);
+    auto chance = std::bernoulli_distribution(ratio);
+
+    auto lhs = std::vector<T>(count);
+    auto rhs = std::vector<T>(count);
+
+    for (auto i = std::size_t(); i != count; ++i)
+    {
+        lhs[i].ForEach([&](auto&& e) { e = static_cast<std::remove_reference_t<decltype(e)>>(engine()); });
+
+        rhs[i] = lhs[i];
+
+        if (chance(engine))
+        {
+            rhs[i].IndexBy(engine() % T::Count, [](auto&& e) { ++e; });
+        }
+    }
+
+    std::printf("%-12s %5.1f%%  ", name, ratio * 100);
+
+    auto n = measure(lhs, rhs, [](auto&& l, auto&& r) { return naive(l, r); });
+    auto d = measure(lhs, rhs, [](auto&& l, auto&& r) { return akr::TupleDiff::Diff(l, r); });
+
+    std::printf("naive %8.2f Mrec/s  Diff %8.2f Mrec/s\n", n, d);
+}
+
+int main()
+{
+    for (auto ratio : { 0.0, 0.01, 0.1, 1.0 })
+    {
+        run<Record>("record", ratio);
+        run<akr::Tuple<std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t,
+                       std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t>>("homogeneous", ratio);
+    }
+}
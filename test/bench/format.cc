@@ -0,0 +1,72 @@
+#include "../../tuple_format.hh"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <sstream>
+#include <vector>
+
+using Record = akr::Tuple<std::uint64_t, const char*, std::int32_t, double, bool, char>;
+
+static volatile std::size_t sink;
+
+template<class F>
+static auto measure(const std::vector<Record>& records, const F& format) -> double
+{
+    auto bytes = std::size_t();
+
+    auto begin = std::chrono::steady_clock::now();
+
+    for (auto&& record : records)
+    {
+        bytes += format(record);
+    }
+
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    sink = bytes;
+
+    return static_cast<double>(records.size()) / elapsed / 1e6;
+}
+
+int main()
+{
+    constexpr auto count = std::size_t(1) << 20;
+
+    const char* names[] = { "ingest", "query", "flush", "compact" };
+
+    auto engine  = std::mt19937_64(42);
+    auto records = std::vector<Record>();
+
+    for (auto i = std::size_t(); i != count; ++i)
+    {
+        records.emplace_back(engine(), names[engine() % 4], static_cast<std::int32_t>(engine()),
+                             std::uniform_real_distribution<double>(0, 1e6)(engine), engine() % 2 == 0, static_cast<char>('A' + engine() % 26));
+    }
+
+    auto stream = std::ostringstream();
+    stream << std::boolalpha;
+
+    auto iostream = measure(records, [&](const Record& record)
+    {
+        auto first = true;
+
+        stream.str({});
+        stream << '(';
+        record.ForEach([&](auto&& e) { stream << (first ? "" : ", ") << e; first = false; });
+        stream << ')';
+
+        return static_cast<std::size_t>(stream.tellp());
+    });
+
+    auto formatToN = measure(records, [](const Record& record)
+    {
+        char buffer[256];
+
+        return static_cast<std::size_t>(akr::TupleFormat::FormatToN(buffer, sizeof(buffer), record).out - buffer);
+    });
+
+    std::printf("%-10s %10.2f Mrec/s\n", "iostream", iostream);
+    std::printf("%-10s %10.2f Mrec/s\n", "FormatToN", formatToN);
+}
@@ -0,0 +1,61 @@
+#!/bin/sh
+# Times a full rebuild of a generated many-TU project that uses akr::Tuple
+# through '#include "tuple.hh"' and through 'import akr.tuple;'.
+# Usage (from test/): sh bench/module_rebuild.sh [compiler] [translation units]
+
+cxx="${1:-g++}"
+count="${2:-100}"
+root="$(cd "$(dirname "$0")/../.." && pwd)"
+work="$(mktemp -d)"
+
+case "$cxx" in
+    *clang*) module_flags="-fmodule-file=akr.tuple=$work/module/akr.tuple.pcm" ;;
+    *)       module_flags="-fmodules-ts" ;;
+esac
+
+mkdir -p "$work/header" "$work/module"
+
+for i in $(seq 1 "$count"); do
+    body="auto f$i(int a, double b) -> double
+{
+    auto t = akr::Tuple(a, b, static_cast<long>($i)) + akr::Tuple($i.5f) & 'c';
+
+    auto s = 0.0;
+
+    t.ForEach([&](auto e) { s += static_cast<double>(e); });
+
+    return s + akr::Tuple<>::Add(akr::Tuple(a, b), akr::Tuple($i, b)).IndexOf<1>();
+}"
+    printf '#include "%s/tuple.hh"\n\n%s\n' "$root" "$body" > "$work/header/tu$i.cc"
+    printf 'import akr.tuple;\n\n%s\n' "$body" > "$work/module/tu$i.cc"
+done
+
+now() { date +%s.%N; }
+
+start=$(now)
+for i in $(seq 1 "$count"); do
+    $cxx -std=c++2b -O2 -c "$work/header/tu$i.cc" -o "$work/header/tu$i.o" || exit 1
+done
+header=$(awk "BEGIN { print $(now) - $start }")
+
+start=$(now)
+(
+    cd "$work/module" || exit 1
+
+    case "$cxx" in
+        *clang*)
+            $cxx -std=c++2b -O2 --precompile -x c++-module "$root/tuple.cppm" -o akr.tuple.pcm || exit 1
+            $cxx -std=c++2b -O2 -c akr.tuple.pcm -o akr.tuple.o || exit 1 ;;
+        *)
+            $cxx -std=c++2b -O2 -fmodules-ts -x c++ -c "$root/tuple.cppm" -o akr.tuple.o || exit 1 ;;
+    esac
+
+    for i in $(seq 1 "$count"); do
+        $cxx -std=c++2b -O2 $module_flags -c "tu$i.cc" -o "tu$i.o" || exit 1
+    done
+) || exit 1
+module=$(awk "BEGIN { print $(now) - $start }")
+
+printf "%-8s %5s TUs  header %8.2f s  module %8.2f s\n" "$cxx" "$count" "$header" "$module"
+
+rm -rf "$work"
@@ -0,0 +1,57 @@
+#include "../../padded_tuple.hh"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using Counter = std::atomic<std::uint64_t>;
+
+template<class T>
+static auto measure(unsigned threads, std::size_t count) -> double
+{
+    auto counters = T();
+    auto workers  = std::vector<std::thread>();
+
+    auto begin = std::chrono::steady_clock::now();
+
+    for (auto i = 0u; i != threads; ++i)
+    {
+        workers.emplace_back([&, i]()
+        {
+            for (auto j = std::size_t(); j != count; ++j)
+            {
+                counters.IndexBy(i, [](auto&& e) { e.fetch_add(1, std::memory_order_relaxed); });
+            }
+        });
+    }
+
+    for (auto&& worker : workers)
+    {
+        worker.join();
+    }
+
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    return static_cast<double>(threads * count) / elapsed / 1e6;
+}
+
+int main()
+{
+    using Plain  = akr::Tuple      <Counter, Counter, Counter, Counter, Counter, Counter, Counter, Counter>;
+    using Padded = akr::PaddedTuple<Counter, Counter, Counter, Counter, Counter, Counter, Counter, Counter>;
+
+    constexpr auto count = std::size_t(1) << 22;
+
+    std::printf("%8s %18s %18s\n", "threads", "Tuple Mops/s", "PaddedTuple Mops/s");
+
+    for (auto threads = 1u; threads <= Plain::Count; threads *= 2)
+    {
+        auto plain  = measure<Plain >(threads, count);
+        auto padded = measure<Padded>(threads, count);
+
+        std::printf("%8u %18.2f %18.2f\n", threads, plain, padded);
+    }
+}
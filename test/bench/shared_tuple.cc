@@ -0,0 +1,81 @@
+#include "../../shared_tuple.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+using Snapshot = akr::Tuple<double, double, std::uint64_t, std::uint32_t>;
+
+template<class R, class W>
+static auto measure(unsigned readers, const R& read, const W& write) -> double
+{
+    auto done    = std::atomic<bool>();
+    auto total   = std::atomic<std::uint64_t>();
+    auto workers = std::vector<std::thread>();
+
+    for (auto i = 0u; i != readers; ++i)
+    {
+        workers.emplace_back([&]()
+        {
+            auto count = std::uint64_t();
+            auto sink  = 0.0;
+
+            while (!done.load(std::memory_order_relaxed))
+            {
+                sink += read().template IndexOf<0>();
+
+                ++count;
+            }
+
+            total += count + (sink < 0);
+        });
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+
+    for (auto i = 0; i != 200; ++i)
+    {
+        write(i);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    done = true;
+
+    for (auto&& worker : workers)
+    {
+        worker.join();
+    }
+
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    return static_cast<double>(total) / elapsed / 1e6;
+}
+
+int main()
+{
+    auto maximum = std::max(1u, std::thread::hardware_concurrency());
+
+    std::printf("%8s %22s %22s\n", "readers", "shared_mutex Mreads/s", "SharedTuple Mreads/s");
+
+    for (auto readers = 1u; readers <= maximum; readers *= 2)
+    {
+        auto mutex  = std::shared_mutex();
+        auto locked = Snapshot();
+        auto shared = akr::SharedTuple(Snapshot());
+
+        auto m = measure(readers,
+            [&]() { auto lock = std::shared_lock(mutex); return locked; },
+            [&](int i) { auto lock = std::unique_lock(mutex); locked = Snapshot(i * 1.0, i * 2.0, std::uint64_t(i), 0u); });
+
+        auto s = measure(readers,
+            [&]() { return shared.Load(); },
+            [&](int i) { shared.Store(Snapshot(i * 1.0, i * 2.0, std::uint64_t(i), 0u)); });
+
+        std::printf("%8u %22.2f %22.2f\n", readers, m, s);
+    }
+}
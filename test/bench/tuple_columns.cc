@@ -0,0 +1,108 @@
+#include "../../tuple_columns.hh"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using Columns = akr::TupleColumns<akr::DeltaColumn<std::int64_t>, akr::DictColumn<std::string>, akr::ForColumn<std::int32_t>, akr::PlainColumn<double>>;
+
+using Row = Columns::Value;
+
+static volatile std::int64_t sink;
+
+template<class F>
+static void measure(const char* name, std::size_t bytes, std::size_t rows, const F& scan)
+{
+    auto begin = std::chrono::steady_clock::now();
+
+    sink = scan();
+
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+
+    std::printf("%-24s %10.2f MiB %10.2f ns/row\n", name, static_cast<double>(bytes) / (1 << 20), elapsed / static_cast<double>(rows));
+}
+
+int main()
+{
+    constexpr auto count = std::size_t(1) << 22;
+
+    const char* statuses[] { "ok", "retry", "failed", "timeout" };
+
+    auto engine  = std::mt19937_64(42);
+    auto rows    = std::vector<Row>();
+    auto columns = Columns();
+    auto time    = std::int64_t(1700000000000);
+
+    rows.reserve(count);
+
+    for (auto i = std::size_t(); i != count; ++i)
+    {
+        time += static_cast<std::int64_t>(engine() % 16);
+
+        rows.emplace_back(time, std::string(statuses[engine() % 100 < 97 ? 0 : engine() % 4]), static_cast<std::int32_t>(engine() % 1000), static_cast<double>(i));
+
+        columns.PushBack(rows.back());
+    }
+
+    measure("vector<Tuple> loop", rows.size() * sizeof(Row), count, [&]()
+    {
+        auto sum = std::int64_t();
+
+        for (auto&& row : rows)
+        {
+            sum += row.IndexOf<0>() + row.IndexOf<2>();
+        }
+
+        return sum;
+    });
+
+    measure("TupleColumns batches", columns.Bytes(), count, [&]()
+    {
+        auto sum = std::int64_t();
+
+        columns.ForEachBatch([&](auto&& times, auto&&, auto&& values, auto&&)
+        {
+            for (std::size_t i = 0; i != times.size(); ++i)
+            {
+                sum += times[i] + values[i];
+            }
+        });
+
+        return sum;
+    });
+
+    measure("TupleColumns Decode<I>", columns.Bytes(), count, [&]()
+    {
+        auto sum    = std::int64_t();
+        auto times  = std::vector<std::int64_t>(Columns::BatchSize);
+        auto values = std::vector<std::int32_t>(Columns::BatchSize);
+
+        for (std::size_t first = 0; first != count; first += Columns::BatchSize)
+        {
+            columns.Decode<0>(first, times);
+            columns.Decode<2>(first, values);
+
+            for (std::size_t i = 0; i != Columns::BatchSize; ++i)
+            {
+                sum += times[i] + values[i];
+            }
+        }
+
+        return sum;
+    });
+
+    measure("TupleColumns rows", columns.Bytes(), count, [&]()
+    {
+        auto sum = std::int64_t();
+
+        for (auto&& row : columns)
+        {
+            sum += row.IndexOf<0>() + row.IndexOf<2>();
+        }
+
+        return sum;
+    });
+}
@@ -0,0 +1,95 @@
+#include "../../tuple_index.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using Row = akr::Tuple<std::uint64_t, std::uint32_t, double>;
+
+static volatile std::uint64_t sink;
+
+template<class F>
+static auto measure(const std::vector<std::uint32_t>& queries, const F& lookup) -> double
+{
+    auto checksum = std::uint64_t();
+
+    auto begin = std::chrono::steady_clock::now();
+
+    for (auto&& query : queries)
+    {
+        checksum += lookup(query);
+    }
+
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+
+    sink = checksum;
+
+    return elapsed / static_cast<double>(queries.size());
+}
+
+int main()
+{
+    constexpr auto lookups = std::size_t(1) << 21;
+
+    std::printf("%10s %22s %22s %22s\n", "rows", "lower_bound ns/lookup", "TupleIndex ns/lookup", "Refresh ns/append");
+
+    for (auto count : { std::size_t(1) << 10, std::size_t(1) << 16, std::size_t(1) << 20, std::size_t(1) << 22 })
+    {
+        auto engine = std::mt19937_64(42);
+
+        auto rows = std::vector<Row>();
+        rows.reserve(count);
+
+        for (auto i = std::size_t(); i != count; ++i)
+        {
+            rows.emplace_back(engine(), static_cast<std::uint32_t>(engine()), static_cast<double>(i));
+        }
+
+        auto queries = std::vector<std::uint32_t>(lookups);
+
+        for (auto&& query : queries)
+        {
+            query = static_cast<std::uint32_t>(engine());
+        }
+
+        auto sorted = rows;
+
+        std::sort(sorted.begin(), sorted.end(), [](auto&& lhs, auto&& rhs) { return lhs.template IndexOf<1>() < rhs.template IndexOf<1>(); });
+
+        auto scan = measure(queries, [&](std::uint32_t query)
+        {
+            auto it = std::lower_bound(sorted.begin(), sorted.end(), query, [](auto&& lhs, auto&& rhs) { return lhs.template IndexOf<1>() < rhs; });
+
+            return it != sorted.end() ? it->IndexOf<0>() : 0;
+        });
+
+        auto index = akr::MakeTupleIndex<1>(rows);
+
+        auto tree = measure(queries, [&](std::uint32_t query)
+        {
+            auto it = index.LowerBound(query);
+
+            return it != index.end() ? it->IndexOf<0>() : 0;
+        });
+
+        constexpr auto appends = std::size_t(1) << 13;
+
+        rows.reserve(count + appends);
+
+        auto begin = std::chrono::steady_clock::now();
+
+        for (auto i = std::size_t(); i != appends; ++i)
+        {
+            rows.emplace_back(engine(), static_cast<std::uint32_t>(engine()), 0.0);
+
+            index.Refresh();
+        }
+
+        auto append = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count() / appends;
+
+        std::printf("%10zu %22.2f %22.2f %22.2f\n", count, scan, tree, append);
+    }
+}
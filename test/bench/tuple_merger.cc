@@ -0,0 +1,119 @@
+#include "../../tuple_merger.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <queue>
+#include <random>
+#include <vector>
+
+using Row = akr::Tuple<std::uint64_t, std::uint32_t, std::uint64_t, std::uint64_t>;
+
+static volatile std::uint64_t sink;
+
+static auto generate(std::size_t runs, std::size_t rows) -> std::vector<std::vector<Row>>
+{
+    auto engine = std::mt19937_64(42);
+    auto result = std::vector<std::vector<Row>>(runs);
+
+    for (auto&& run : result)
+    {
+        for (auto i = std::size_t(); i != rows; ++i)
+        {
+            run.emplace_back(engine() % 1000000, static_cast<std::uint32_t>(engine()), engine(), engine());
+        }
+
+        std::sort(run.begin(), run.end(), [](auto&& lhs, auto&& rhs)
+        {
+            return lhs.template IndexOf<0>() != rhs.template IndexOf<0>() ? lhs.template IndexOf<0>() < rhs.template IndexOf<0>()
+                                                                          : lhs.template IndexOf<1>() < rhs.template IndexOf<1>();
+        });
+    }
+
+    return result;
+}
+
+template<class F>
+static auto measure(std::size_t runs, std::size_t rows, const F& merge) -> double
+{
+    auto input = generate(runs, rows);
+
+    auto begin = std::chrono::steady_clock::now();
+
+    sink = merge(input);
+
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    return static_cast<double>(runs * rows) / elapsed / 1e6;
+}
+
+int main()
+{
+    constexpr auto total = std::size_t(1) << 22;
+
+    std::printf("%6s %16s %16s\n", "runs", "heap Mrow/s", "MergeSorted Mrow/s");
+
+    for (auto runs : { std::size_t(2), std::size_t(8), std::size_t(32), std::size_t(128) })
+    {
+        auto heap = measure(runs, total / runs, [](std::vector<std::vector<Row>>& input)
+        {
+            using Entry = std::pair<Row, std::size_t>;
+
+            auto greater = [](const Entry& lhs, const Entry& rhs)
+            {
+                auto&& l = lhs.first;
+                auto&& r = rhs.first;
+
+                return l.IndexOf<0>() != r.IndexOf<0>() ? l.IndexOf<0>() > r.IndexOf<0>() : l.IndexOf<1>() > r.IndexOf<1>();
+            };
+
+            auto queue     = std::priority_queue<Entry, std::vector<Entry>, decltype(greater)>(greater);
+            auto positions = std::vector<std::size_t>(input.size());
+            auto checksum  = std::uint64_t();
+
+            for (std::size_t i = 0; i != input.size(); ++i)
+            {
+                queue.emplace(input[i][positions[i]++], i);
+            }
+
+            while (!queue.empty())
+            {
+                auto [row, i] = queue.top();
+
+                queue.pop();
+
+                checksum += row.IndexOf<2>();
+
+                if (positions[i] != input[i].size())
+                {
+                    queue.emplace(input[i][positions[i]++], i);
+                }
+            }
+
+            return checksum;
+        });
+
+        auto tree = measure(runs, total / runs, [](std::vector<std::vector<Row>>& input)
+        {
+            using I = std::vector<Row>::iterator;
+
+            auto ranges   = std::vector<std::pair<I, I>>();
+            auto checksum = std::uint64_t();
+
+            for (auto&& run : input)
+            {
+                ranges.emplace_back(run.begin(), run.end());
+            }
+
+            for (auto&& row : akr::TupleMerger<I, I, 0, 1>(std::move(ranges)))
+            {
+                checksum += row.IndexOf<2>();
+            }
+
+            return checksum;
+        });
+
+        std::printf("%6zu %16.2f %16.2f\n", runs, heap, tree);
+    }
+}
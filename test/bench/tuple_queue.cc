@@ -0,0 +1,128 @@
+#include "../../tuple_queue.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using Message = akr::Tuple<std::uint64_t, std::uint64_t>;
+
+struct LockedQueue final
+{
+    public:
+    std::mutex mutex;
+
+    std::deque<Message> queue;
+
+    explicit LockedQueue(std::size_t)
+    {
+    }
+
+    auto TryEmplace(std::uint64_t stamp, std::uint64_t sequence) -> bool
+    {
+        auto lock = std::lock_guard(mutex);
+
+        queue.emplace_back(stamp, sequence);
+
+        return true;
+    }
+
+    auto TryPop(Message& value) -> bool
+    {
+        auto lock = std::lock_guard(mutex);
+
+        if (queue.empty())
+        {
+            return false;
+        }
+
+        value = queue.front();
+
+        queue.pop_front();
+
+        return true;
+    }
+};
+
+static auto now() -> std::uint64_t
+{
+    return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+}
+
+template<class Q>
+static void measure(const char* name, unsigned producers, std::size_t count)
+{
+    auto queue     = Q(4096);
+    auto latencies = std::vector<std::uint64_t>();
+    auto workers   = std::vector<std::thread>();
+
+    latencies.reserve(count * producers);
+
+    auto begin = std::chrono::steady_clock::now();
+
+    for (auto p = 0u; p != producers; ++p)
+    {
+        workers.emplace_back([&]()
+        {
+            for (auto i = std::size_t(); i != count; ++i)
+            {
+                while (!queue.TryEmplace(now(), i))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    auto message = Message();
+
+    while (latencies.size() != count * producers)
+    {
+        if (queue.TryPop(message))
+        {
+            latencies.push_back(now() - message.IndexOf<0>());
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    for (auto&& worker : workers)
+    {
+        worker.join();
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+
+    auto percentile = [&](double p) { return static_cast<double>(latencies[static_cast<std::size_t>(p * (latencies.size() - 1))]) / 1e3; };
+
+    std::printf("%-8s %3u %12.2f %10.2f %10.2f %10.2f\n", name, producers,
+                static_cast<double>(latencies.size()) / elapsed / 1e6, percentile(0.5), percentile(0.99), percentile(0.999));
+}
+
+int main()
+{
+    constexpr auto count = std::size_t(1) << 20;
+
+    std::printf("%-8s %3s %12s %10s %10s %10s\n", "queue", "P", "Mmsg/s", "p50 us", "p99 us", "p99.9 us");
+
+    using Spsc = akr::SpscTupleQueue<std::uint64_t, std::uint64_t>;
+    using Mpsc = akr::MpscTupleQueue<std::uint64_t, std::uint64_t>;
+
+    measure<LockedQueue>("mutex", 1, count);
+    measure<Spsc       >("spsc" , 1, count);
+    measure<Mpsc       >("mpsc" , 1, count);
+
+    for (auto producers = 2u; producers <= 4; producers *= 2)
+    {
+        measure<LockedQueue>("mutex", producers, count / producers);
+        measure<Mpsc       >("mpsc" , producers, count / producers);
+    }
+}
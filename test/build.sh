@@ -0,0 +1,38 @@
+#!/bin/sh
+# Builds and runs the test suite once per configuration:
+#   default   as configured by the compiler
+#   cx16      -mcx16, so 16-byte AtomicTuples take the cmpxchg16b path (x86-64 only)
+#   trace     -DD_AKR_TUPLE_TRACE, so the TupleTrace counters and their test are compiled in
+# Usage: sh build.sh [compiler] [extra flags...]
+
+cxx="${1:-g++}"
+
+[ $# -gt 0 ] && shift
+
+mkdir -p ./out
+
+status=0
+
+run() {
+    name="$1"
+
+    shift
+
+    if $cxx "main.cc" -o"./out/main$cxx-$name" -Wall -Wextra -std="c++2b" -pthread "$@" && "./out/main$cxx-$name" > "./out/main$cxx-$name.txt"; then
+        printf "%-8s %-8s OK\n" "$cxx" "$name"
+    else
+        printf "%-8s %-8s FAIL\n" "$cxx" "$name"
+
+        status=1
+    fi
+}
+
+run default "$@"
+
+run trace -DD_AKR_TUPLE_TRACE "$@"
+
+case "$(uname -m)" in
+    x86_64|amd64) run cx16 -mcx16 "$@" ;;
+esac
+
+exit $status
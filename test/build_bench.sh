@@ -0,0 +1,3 @@
+#!/bin/sh
+mkdir -p ./out
+$1 "bench/$2.cc" -o"./out/$2$1$3" -Wall -Wextra -std="c++2b" -O2 -pthread $3
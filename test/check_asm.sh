@@ -0,0 +1,107 @@
+#!/bin/sh
+# Compiles asm/probes.cc at -O2 and checks every probe marked with
+#   // AKR_ASM <symbol> <max instructions> <max branches> <max calls>
+# against its disassembly. Padding and cold (.cold) paths are not counted.
+# Objects marked with
+#   // AKR_RODATA <symbol> [relocated]
+# must be placed in .rodata, and the file must need no dynamic initialization. Tables holding pointers land in
+# .data.rel.ro instead, which the loader writes to in a PIE and so costs private dirty pages; that is reported as
+# RELOCATED, and fails unless the probe is marked 'relocated'.
+# Usage: sh check_asm.sh [compiler...]   (default: g++, and clang++ when installed)
+
+compilers="$*"
+
+if [ -z "$compilers" ]; then
+    compilers="g++"
+
+    if command -v clang++ > /dev/null 2>&1; then
+        compilers="$compilers clang++"
+    fi
+fi
+
+mkdir -p ./out
+
+status=0
+
+for cxx in $compilers; do
+    obj="./out/probes$cxx.o"
+
+    if ! $cxx "asm/probes.cc" -o"$obj" -Wall -Wextra -std="c++2b" -O2 -c; then
+        status=1
+
+        continue
+    fi
+
+    probes=$(grep '^// AKR_ASM ' asm/probes.cc)
+
+    while read -r _ _ name max_insns max_branches max_calls; do
+        counts=$(objdump -d -r --no-show-raw-insn -Mintel --disassemble="$name" "$obj" | awk '
+            function hex(text,    i, value) {
+                sub(/:.*/, "", text)
+                gsub(/[ \t]/, "", text)
+                for (i = 1; i <= length(text); i++) value = value * 16 + index("0123456789abcdef", substr(text, i, 1)) - 1
+                return value
+            }
+            BEGIN { pending = -1 }
+            /^ *[0-9a-f]+:\t/ {
+                split($0, part, "\t")
+                n = split(part[2], word, /[ ,]+/)
+                m = word[1]
+                if (m == "notrack" || m == "bnd") { m = word[2]; operand = word[3] } else { operand = word[2] }
+                pending = -1
+                if (m ~ /^(nop|nopw|nopl|data16|endbr64|int3)$/ || (m == "xchg" && operand == "ax")) next
+                insns++
+                if (m == "call") calls++
+                else if (m == "jmp" && operand !~ /^[0-9a-f]+$/) branches++
+                else if (m == "jmp") pending = hex(part[1])
+                else if (m ~ /^j/) branches++
+                next
+            }
+            /^\t+[0-9a-f]+: R_/ {
+                offset = hex($1)
+                if (pending >= 0 && offset > pending && offset <= pending + 3 && $0 !~ /\.cold|\.text\.unlikely/) calls++
+            }
+            END { printf "%d %d %d\n", insns, branches, calls }')
+
+        set -- $counts
+
+        result="OK"
+
+        if [ "$1" -eq 0 ] || [ "$1" -gt "$max_insns" ] || [ "$2" -gt "$max_branches" ] || [ "$3" -gt "$max_calls" ]; then
+            result="FAIL"
+
+            status=1
+        fi
+
+        printf "%-8s %-24s insns %3d/%-3d branches %2d/%-2d calls %2d/%-2d %s\n" \
+            "$cxx" "$name" "$1" "$max_insns" "$2" "$max_branches" "$3" "$max_calls" "$result"
+    done <<EOF
+$probes
+EOF
+
+    if objdump -t "$obj" | grep -q '_GLOBAL__sub_I'; then
+        printf "%-8s %-24s dynamic initialization FAIL\n" "$cxx" "asm/probes.cc"
+
+        status=1
+    fi
+
+    rodata=$(grep '^// AKR_RODATA ' asm/probes.cc)
+
+    while read -r _ _ name relocated; do
+        section=$(objdump -t "$obj" | awk -v name="$name" '$NF == name { print $(NF - 2) }')
+
+        case "$section" in
+            .rodata*)      result="OK" ;;
+            .data.rel.ro*) result="RELOCATED"; [ "$relocated" = "relocated" ] || { result="RELOCATED FAIL"; status=1; } ;;
+            *)             result="FAIL"; status=1 ;;
+        esac
+
+        printf "%-8s %-24s section %-17s %s\n" "$cxx" "$name" "${section:-none}" "$result"
+    done <<EOF
+$rodata
+EOF
+
+    rm -f "$obj"
+done
+
+exit $status
@@ -2,11 +2,35 @@
 #include "akr_test.hh"
 
 #include "../tuple.hh"
+#include "../atomic_tuple.hh"
+#include "../bit_tuple.hh"
+#include "../c_tuple.hh"
+#include "../dynamic_tuple.hh"
+#include "../lazy_tuple.hh"
+#include "../padded_tuple.hh"
+#include "../shared_tuple.hh"
+#include "../split_tuple.hh"
+#include "../tracked_tuple.hh"
+#include "../tuple_columns.hh"
+#include "../tuple_diff.hh"
+#include "../tuple_format.hh"
+#include "../tuple_generator.hh"
+#include "../tuple_index.hh"
+#include "../tuple_merger.hh"
+#include "../tuple_queue.hh"
+#include "../wire_tuple.hh"
 
 #include <iostream>
+#include <iterator>
+#include <string>
+#include <tuple>
+#include <vector>
 
-int main()
+int main(int argc, char* argv[])
 {
+    {
+        auto t1 = akr::Tuple<>::Add(akr::Tuple(1.0f, 2.0f, 3.0f, 4.0f), akr::Tuple(4.0f, 3.0f, 2.0f, 1.0f));
+    }
     {
         auto t1 = akr::Tuple();
 
@@ -35,11 +59,31 @@ int main()
 
         auto t2 = akr::Tuple<>::Create(true, 'A', 123, 3.14, "ABC", nullptr);
     }
+    {
+        auto t1 = akr::Tuple(1, 'A', 3.14);
+        auto t2 = akr::Tuple(1, 'B', 3.14);
+
+        auto d1 = akr::TupleDiff::Diff(t1, t2);
+
+        akr::TupleDiff::Patch(t1, d1, t2);
+    }
+    {
+        auto t1 = akr::Tuple<std::string, std::string>(std::piecewise_construct, std::forward_as_tuple(3, 'A'), std::forward_as_tuple("BC"));
+
+        t1.Emplace<0>(2, 'D');
+    }
     {
         auto t1 = akr::Tuple(true, 'A', 123, 3.14, "ABC", nullptr);
 
         t1.ForEach(   [](auto&& e) { std::cout << std::boolalpha << e << '\n'; });
     }
+    {
+        char b1[64];
+
+        auto r1 = akr::TupleFormat::FormatToN(b1, sizeof(b1), akr::Tuple(true, 'A', 123, 3.14, "ABC", nullptr));
+
+        std::cout << std::string_view(b1, r1.out) << '\n';
+    }
     {
         auto t1 = akr::Tuple(true, 'A', 123, 3.14, "ABC", nullptr);
 
@@ -59,4 +103,159 @@ int main()
 
         t1.IndexOf<0>() = false;
     }
+    {
+        auto t1 = akr::Tuple<>::Map(akr::Tuple(1, 2.5), [](auto&& e) { return e * 2; });
+    }
+    {
+        constexpr auto t1 = akr::Tuple<>::Sort<0>(std::array { akr::Tuple(std::string_view("B"), 2u), akr::Tuple(std::string_view("A"), 1u) });
+
+        constinit static auto t2 = akr::Tuple<>::Concat(akr::Tuple(1), 2.5) & 'A';
+    }
+    {
+        auto t1 = akr::Tuple(1.0, 2.0, 3.0, 4.0);
+
+        for (auto&& e : t1.Span()) { e *= 2; }
+    }
+    {
+        auto t1 = akr::Tuple<>::Zip(akr::Tuple(1, 2.5), akr::Tuple(2, 0.5), [](auto&& l, auto&& r) { return l + r; });
+    }
+    {
+        auto t1 = akr::AtomicTuple(akr::Tuple(1u, 2u));
+
+        t1.Update([](auto&& e) { return akr::Tuple(e.template IndexOf<0>() + 1, e.template IndexOf<1>()); });
+    }
+    {
+        auto t1 = akr::SharedTuple(akr::Tuple(1, 3.14));
+
+        t1.Store(akr::Tuple(2, 2.71));
+
+        auto t2 = t1.Load();
+    }
+    {
+        auto t1 = akr::BitTuple<akr::Bits<1>, akr::Bits<1>, akr::Bits<3>>(true, false, 5);
+
+        t1.IndexOf<2>() = 6;
+
+        std::cout << std::hash<decltype(t1)>()(t1) << '\n';
+    }
+    {
+        auto t1 = akr::CTuple('A', 1, 3.14);
+
+        static_assert(decltype(t1)::OffsetOf<2>() == 8);
+
+        auto t2 = t1.Materialize();
+    }
+    {
+        auto t1 = akr::PaddedTuple<std::atomic<int>, std::atomic<int>>();
+
+        t1.IndexOf<1>().fetch_add(1);
+    }
+    {
+        auto t1 = akr::TrackedTuple(1, 'A', 3.14);
+
+        t1.IndexOf<1>() = 'B';
+
+        auto d1 = std::vector<std::byte>();
+
+        t1.SerializeDelta(std::back_inserter(d1));
+
+        t1.ClearDirty();
+    }
+    {
+        std::byte b1[6] {};
+
+        auto t1 = akr::WireTuple<akr::BE<std::uint32_t>, akr::LE<std::uint16_t>>(b1);
+
+        t1.IndexOf<0>() = 0x12345678u;
+
+        auto t2 = t1.Materialize();
+    }
+    {
+        auto t1 = akr::LazyTuple(1, akr::Lazy([]() { return std::string("ABC"); }));
+
+        std::cout << t1.IsComputed<1>() << ' ' << t1.IndexOf<1>() << '\n';
+
+        auto t2 = akr::SyncLazyTuple(akr::Lazy([]() { return 3.14; }));
+    }
+    {
+        auto t1 = akr::SplitTuple(akr::Tuple(1, 2u), akr::Tuple(std::string("ABC"), 3.14));
+
+        t1.IndexOf<2>() += "D";
+
+        auto t2 = t1.HotPart();
+    }
+    {
+        auto source = [](int count) -> akr::TupleGenerator<int, double>
+        {
+            for (auto i = 0; i != count; ++i)
+            {
+                co_yield akr::Tuple(i, i * 0.5);
+            }
+        };
+
+        for (auto&& batch : source(100).Filter([](auto&& e) { return e.template IndexOf<0>() % 2; }).Project<1>().Batch(16))
+        {
+            std::cout << batch.size() << '\n';
+        }
+    }
+    {
+        auto q1 = akr::SpscTupleQueue<int, double>(1024);
+
+        q1.TryEmplace(1, 3.14);
+
+        auto t1 = akr::Tuple<int, double>();
+
+        q1.TryPop(t1);
+    }
+    {
+        auto r1 = std::vector<akr::Tuple<int, double>>({ akr::Tuple(1, 0.1), akr::Tuple(4, 0.4) });
+        auto r2 = std::vector<akr::Tuple<int, double>>({ akr::Tuple(2, 0.2), akr::Tuple(3, 0.3) });
+
+        for (auto&& e : akr::MergeSorted<0>(r1, r2))
+        {
+            std::cout << e.IndexOf<1>() << '\n';
+        }
+    }
+    {
+        auto rows = std::vector<akr::Tuple<int, std::string>>({ akr::Tuple(5, std::string("A")), akr::Tuple(2, std::string("B")) });
+
+        auto i1 = akr::MakeTupleIndex<0>(rows);
+
+        rows.emplace_back(3, "C");
+
+        i1.Refresh();
+
+        for (auto&& e : i1.Range(2, 5))
+        {
+            std::cout << e.IndexOf<1>() << '\n';
+        }
+    }
+    {
+        auto c1 = akr::TupleColumns<akr::DeltaColumn<std::int64_t>, akr::DictColumn<std::string>, akr::RleColumn<char>>();
+
+        c1.PushBack(akr::Tuple(std::int64_t(1000), std::string("ok"), 'A'));
+        c1.PushBack(akr::Tuple(std::int64_t(1003), std::string("ok"), 'A'));
+
+        c1.ForEachBatch([](auto&& times, auto&& statuses, auto&&)
+        {
+            std::cout << times.size() << ' ' << statuses.front() << '\n';
+        });
+
+        std::cout << c1.Get(1).IndexOf<0>() << ' ' << c1.Bytes() << '\n';
+    }
+    {
+        auto schema = std::make_shared<const akr::DynamicSchema>(akr::DynamicSchema({ akr::DynamicType::Int32, akr::DynamicType::String }));
+
+        auto t1 = akr::DynamicTuple(schema);
+
+        t1.Get<std::int32_t>(0) = 1;
+
+        t1.IndexBy(1, [](auto&& e) { std::cout << sizeof(e) << '\n'; });
+
+        auto t2 = t1.To<std::int32_t, std::string>();
+
+        auto t3 = akr::DynamicTuple(akr::Tuple(1.5, true));
+    }
+
+    return akr::test::Registry::Run(argc, argv);
 }
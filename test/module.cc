@@ -0,0 +1,50 @@
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+import akr.tuple;
+
+// Link-and-run smoke test for 'import akr.tuple;', built by module.sh.
+int main()
+{
+    auto failed = 0;
+
+    auto check = [&](bool passed, const char* what)
+    {
+        if (!passed)
+        {
+            std::printf("[FAIL] %s\n", what);
+
+            ++failed;
+        }
+    };
+
+    auto t1 = akr::Tuple<>::Add(akr::Tuple(1.0f, 2.0f), akr::Tuple(3.0f, 4.0f));
+    check(t1.IndexOf<0>() == 4.0f && t1.IndexOf<1>() == 6.0f, "Add");
+
+    auto t2 = akr::Tuple<float, float>();
+    check(t2.IndexOf<1>() == 0.0f, "homogeneous default constructor");
+
+    auto t3 = akr::Tuple<>::Concat(akr::Tuple(1, 2.5), 'A') & 3u;
+    t3.Emplace<0>(7);
+    check(t3.IndexOf<0>() == 7 && t3.IndexOf<3>() == 3u, "Concat, Append and Emplace");
+
+    auto t4 = akr::Tuple<>::Sort<0>(std::array { akr::Tuple(2, 'B'), akr::Tuple(1, 'A') });
+    check(t4[0].IndexOf<1>() == 'A', "Sort");
+
+    auto t6 = akr::Tuple(1, 2.5, 'C');
+    akr::TupleDiff::Patch(t6, akr::TupleDiff::Diff(t6, akr::Tuple(1, 3.5, 'C')), akr::Tuple(0, 3.5, 'D'));
+    check(t6.IndexOf<0>() == 1 && t6.IndexOf<1>() == 3.5 && t6.IndexOf<2>() == 'C', "Diff and Patch");
+
+    check(std::strcmp(akr::TupleFormat::ToString(akr::Tuple(-12, 2.5, 'C', true)).c_str(), "(-12, 2.5, C, true)") == 0, "ToString");
+
+    char buffer[8];
+
+    auto t5 = akr::TupleFormat::FormatToN(buffer, sizeof(buffer), akr::Tuple(123456789u, 42L));
+    check(t5.size == 15 && std::memcmp(buffer, "(1234567", sizeof(buffer)) == 0, "FormatToN");
+
+    std::printf("%s\n", failed ? "module FAIL" : "module OK");
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,60 @@
+#!/bin/sh
+# Builds the akr.tuple module and module.cc against it, links and runs them once per optimization level, then checks
+# that implementation details such as akr::TupleHelper are not exported.
+# Usage: sh module.sh [compiler]
+
+cxx="${1:-g++}"
+root="$(cd "$(dirname "$0")/.." && pwd)"
+work="$(mktemp -d)"
+
+status=0
+
+run() {
+    level="$1"
+
+    rm -rf "$work/$level" && mkdir -p "$work/$level"
+
+    if (
+        cd "$work/$level" || exit 1
+
+        case "$cxx" in
+            *clang*)
+                $cxx -std=c++2b "$level" --precompile -x c++-module "$root/tuple.cppm" -o akr.tuple.pcm &&
+                $cxx -std=c++2b "$level" -c akr.tuple.pcm -o akr.tuple.o &&
+                $cxx -std=c++2b "$level" -fmodule-file=akr.tuple=akr.tuple.pcm -c "$root/test/module.cc" -o module.o ;;
+            *)
+                $cxx -std=c++2b "$level" -fmodules-ts -x c++ -c "$root/tuple.cppm" -o akr.tuple.o &&
+                $cxx -std=c++2b "$level" -fmodules-ts -c "$root/test/module.cc" -o module.o ;;
+        esac &&
+
+        $cxx module.o akr.tuple.o -o module && ./module > /dev/null
+    ); then
+        printf "%-8s %-8s OK\n" "$cxx" "$level"
+    else
+        printf "%-8s %-8s FAIL\n" "$cxx" "$level"
+
+        status=1
+    fi
+}
+
+run -O0
+run -O2
+
+printf 'import akr.tuple;\n\nauto f() -> bool { return akr::TupleHelper<int>::IsTuple; }\n' > "$work/-O2/private.cc"
+
+case "$cxx" in
+    *clang*) module_flags="-fmodule-file=akr.tuple=akr.tuple.pcm" ;;
+    *)       module_flags="-fmodules-ts" ;;
+esac
+
+if (cd "$work/-O2" && $cxx -std=c++2b $module_flags -c private.cc -o private.o 2> /dev/null); then
+    printf "%-8s %-8s FAIL\n" "$cxx" "private"
+
+    status=1
+else
+    printf "%-8s %-8s OK\n" "$cxx" "private"
+fi
+
+rm -rf "$work"
+
+exit $status
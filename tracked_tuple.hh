@@ -0,0 +1,349 @@
+#ifndef Z_AKR_TRACKED_TUPLE_HH
+#define Z_AKR_TRACKED_TUPLE_HH
+
+#include "tuple.hh"
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+
+namespace akr
+{
+    template<class... T>
+    struct TrackedTuple final
+    {
+        public:
+        static constexpr auto Count = sizeof...(T);
+
+        inline static constexpr bool IsSerializable = (... && std::is_trivially_copyable_v<T>);
+
+        private:
+        inline static constexpr std::size_t MaskSize = (Count + 7) / 8;
+
+        inline static constexpr std::array<std::size_t, Count> Sizes { sizeof(T)... };
+
+        Tuple<T...> value {};
+
+        std::bitset<Count> dirty {};
+
+        public:
+        constexpr TrackedTuple() = default;
+
+        template<class V>
+        requires(TupleHelper<V>::IsTuple && Count == TupleHelper<V>::CountOf())
+        explicit constexpr TrackedTuple(V&& value_)
+            noexcept(std::is_nothrow_constructible_v<Tuple<T...>, V&&>):
+            value(std::forward<V>(value_))
+        {
+        }
+
+        template<class... V>
+        requires(sizeof...(V) == Count && !(Count == 1 && (... && TupleHelper<V>::IsTuple)))
+        explicit constexpr TrackedTuple(V&&... values)
+            noexcept(std::is_nothrow_constructible_v<Tuple<T...>, V&&...>):
+            value(std::forward<V>(values)...)
+        {
+        }
+
+        public:
+        template<class F>
+        void ForEach(const F& func)
+            noexcept(noexcept(value.ForEach(func)))
+        {
+            dirty.set();
+
+            value.ForEach(func);
+        }
+
+        template<class F>
+        void IndexBy(std::size_t index, const F& func)
+        {
+            if (index >= Count)
+            {
+                throw std::out_of_range("index out of range.");
+            }
+
+            // Marked first, so an element func changed before throwing still counts as dirty.
+            dirty.set(index);
+
+            value.IndexBy(index, func);
+        }
+
+        template<std::size_t I>
+        requires(I < Count)
+        auto IndexOf()       noexcept ->       auto&
+        {
+            dirty.set(I);
+
+            return value.template IndexOf<I>();
+        }
+
+        template<class F>
+        void ForEachDirty(const F& func)
+        {
+            [&]<std::size_t... I_>(std::index_sequence<I_...>)
+            {
+                (..., (dirty.test(I_) ? static_cast<void>(func(value.template IndexOf<I_>())) : void()));
+            }
+            (std::make_index_sequence<Count>{});
+        }
+
+        void ClearDirty() noexcept
+        {
+            dirty.reset();
+        }
+
+        template<class I>
+        requires(IsSerializable && std::is_same_v<std::byte, std::remove_cvref_t<decltype(*std::declval<I&>())>>)
+        auto ApplyDelta(I begin, I end) -> I
+        {
+            auto mask = std::bitset<Count>();
+
+            for (std::size_t i = 0; i != MaskSize; ++i)
+            {
+                auto bits = static_cast<unsigned long long>(read(begin, end));
+
+                if (i + 1 == MaskSize && (bits >> (Count - i * 8)) != 0)
+                {
+                    throw std::invalid_argument("delta mask out of range.");
+                }
+
+                mask |= std::bitset<Count>(bits) << (i * 8);
+            }
+
+            // Only the masked elements are staged, and none is written until the whole delta has been read, so a
+            // truncated delta leaves the value untouched and the cost follows the delta, not the record size.
+            std::array<std::byte, (std::size_t(0) + ... + sizeof(T))> staged;
+
+            auto size = std::size_t(0);
+
+            for (std::size_t i = 0; i != Count; ++i)
+            {
+                for (auto n = mask.test(i) ? Sizes[i] : 0; n != 0; --n)
+                {
+                    staged[size++] = read(begin, end);
+                }
+            }
+
+            size = 0;
+
+            [&]<std::size_t... I_>(std::index_sequence<I_...>)
+            {
+                (..., (mask.test(I_) ? commit(value.template IndexOf<I_>(), staged.data(), size) : void()));
+            }
+            (std::make_index_sequence<Count>{});
+
+            return begin;
+        }
+
+        public:
+        template<class F>
+        constexpr void ForEach(const F& func) const
+            noexcept(noexcept(value.ForEach(func)))
+        {
+            value.ForEach(func);
+        }
+
+        template<class F>
+        constexpr void IndexBy(std::size_t index, const F& func) const
+        {
+            value.IndexBy(index, func);
+        }
+
+        template<std::size_t I>
+        requires(I < Count)
+        constexpr auto IndexOf() const noexcept -> const auto&
+        {
+            return value.template IndexOf<I>();
+        }
+
+        template<class F>
+        void ForEachDirty(const F& func) const
+        {
+            [&]<std::size_t... I_>(std::index_sequence<I_...>)
+            {
+                (..., (dirty.test(I_) ? static_cast<void>(func(value.template IndexOf<I_>())) : void()));
+            }
+            (std::make_index_sequence<Count>{});
+        }
+
+        constexpr auto Dirty() const noexcept -> const std::bitset<Count>&
+        {
+            return dirty;
+        }
+
+        constexpr auto Value() const noexcept -> const Tuple<T...>&
+        {
+            return value;
+        }
+
+        template<class O>
+        requires(IsSerializable)
+        auto SerializeDelta(O out) const -> O
+        {
+            for (std::size_t i = 0; i != MaskSize; ++i)
+            {
+                *out++ = static_cast<std::byte>(((dirty >> (i * 8)) & std::bitset<Count>(0xFF)).to_ullong());
+            }
+
+            [&]<std::size_t... I_>(std::index_sequence<I_...>)
+            {
+                (..., (dirty.test(I_) ? store(out, value.template IndexOf<I_>()) : void()));
+            }
+            (std::make_index_sequence<Count>{});
+
+            return out;
+        }
+
+        private:
+        template<class I>
+        static auto read(I& begin, const I& end) -> std::byte
+        {
+            if (begin == end)
+            {
+                throw std::out_of_range("delta truncated.");
+            }
+
+            return *begin++;
+        }
+
+        template<class E>
+        static void commit(E& element, const std::byte* staged, std::size_t& offset) noexcept
+        {
+            std::memcpy(static_cast<void*>(&element), staged + offset, sizeof(E));
+
+            offset += sizeof(E);
+        }
+
+        template<class O, class E>
+        static void store(O& out, const E& element)
+        {
+            std::byte bytes[sizeof(E)];
+
+            std::memcpy(bytes, static_cast<const void*>(&element), sizeof(E));
+
+            for (auto&& e : bytes)
+            {
+                *out++ = e;
+            }
+        }
+    };
+
+    template<class V, class... W>
+    explicit TrackedTuple(V&& value_, W&&... values) -> TrackedTuple<std::decay_t<V>, std::decay_t<W>...>;
+
+    template<class... V>
+    explicit TrackedTuple(const Tuple<V...>& value_) -> TrackedTuple<V...>;
+
+    template<class... V>
+    explicit TrackedTuple(      Tuple<V...>&& value_) -> TrackedTuple<V...>;
+}
+
+#ifdef  D_AKR_TEST
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace akr::test
+{
+    AKR_TEST(TrackedTuple,
+    {
+        auto t1 = TrackedTuple(1, 'A', 3.14, 7ll);
+        AKR_CHECK(t1.Dirty().none());
+
+        t1.IndexOf<1>() = 'B';
+        t1.IndexOf<3>() = 8;
+        AKR_CHECK(t1.Dirty().count() == 2);
+        AKR_CHECK(t1.Dirty().test(1));
+        AKR_CHECK(t1.Dirty().test(3));
+
+        AKR_CHECK(std::as_const(t1).IndexOf<0>() == 1);
+        AKR_CHECK(t1.Dirty().count() == 2);
+
+        auto visited = 0;
+        t1.ForEachDirty([&](auto&&) { ++visited; });
+        AKR_CHECK(visited == 2);
+
+        auto delta = std::vector<std::byte>();
+        t1.SerializeDelta(std::back_inserter(delta));
+        AKR_CHECK(delta.size() == 1 + sizeof(char) + sizeof(long long));
+
+        auto t2 = TrackedTuple(Tuple(0, 'A', 0.0, 0ll));
+        auto end = t2.ApplyDelta(delta.begin(), delta.end());
+        AKR_CHECK(end == delta.end());
+        AKR_CHECK(t2.IndexOf<0>() == 0);
+        AKR_CHECK(t2.IndexOf<1>() == 'B');
+        AKR_CHECK(t2.IndexOf<2>() == 0.0);
+        AKR_CHECK(t2.IndexOf<3>() == 8);
+
+        t1.ClearDirty();
+        AKR_CHECK(t1.Dirty().none());
+
+        t1.IndexBy(2, [](auto&& e) { e = 2.71; });
+        AKR_CHECK(t1.Dirty().test(2));
+        AKR_CHECK(t1.Dirty().count() == 1);
+
+        t1.ForEach([](auto&&) {});
+        AKR_CHECK(t1.Dirty().all());
+
+        auto t4 = TrackedTuple(Tuple(0, 'A', 0.0, 0ll));
+        auto thrown = false;
+        try
+        {
+            t4.ApplyDelta(delta.begin(), delta.end() - 1);
+        }
+        catch (const std::out_of_range&)
+        {
+            thrown = true;
+        }
+        AKR_CHECK(thrown);
+        AKR_CHECK(t4.IndexOf<1>() == 'A');
+        AKR_CHECK(t4.IndexOf<3>() == 0);
+
+        auto bad = std::vector<std::byte>({ std::byte(0x10) });
+        thrown = false;
+        try
+        {
+            t4.ApplyDelta(bad.begin(), bad.end());
+        }
+        catch (const std::invalid_argument&)
+        {
+            thrown = true;
+        }
+        AKR_CHECK(thrown);
+
+        auto t5 = TrackedTuple(1, 2, 3, 4, 5, 6, 7, 8, 9);
+        t5.IndexOf<0>() = 10;
+        t5.IndexOf<8>() = 90;
+        delta.clear();
+        t5.SerializeDelta(std::back_inserter(delta));
+        AKR_CHECK(delta.size() == 2 + 2 * sizeof(int));
+        auto t6 = TrackedTuple(0, 0, 0, 0, 0, 0, 0, 0, 0);
+        t6.ApplyDelta(delta.begin(), delta.end());
+        AKR_CHECK(t6.IndexOf<0>() == 10 && t6.IndexOf<8>() == 90 && t6.IndexOf<4>() == 0);
+
+        t1.ClearDirty();
+        thrown = false;
+        try
+        {
+            t1.IndexBy(0, [](auto&& e) { e = {}; throw std::runtime_error("func failed."); });
+        }
+        catch (const std::runtime_error&)
+        {
+            thrown = true;
+        }
+        AKR_CHECK(thrown);
+        AKR_CHECK(t1.Dirty().test(0));
+
+        auto t3 = TrackedTuple(std::string("A"), 1);
+        static_assert(!t3.IsSerializable);
+        t3.IndexOf<0>() += "B";
+        AKR_CHECK(t3.Value().IndexOf<0>() == "AB");
+        AKR_CHECK(t3.Dirty().test(0));
+    });
+}
+#endif//D_AKR_TEST
+
+#endif//Z_AKR_TRACKED_TUPLE_HH
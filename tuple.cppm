@@ -0,0 +1,47 @@
+module;
+
+#include <array>
+#include <bitset>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<format>)
+#include <format>
+#endif
+
+export module akr.tuple;
+
+#undef  D_AKR_TEST
+#define D_AKR_TUPLE_MODULE
+#include "tuple.hh"
+#include "tuple_diff.hh"
+#include "tuple_format.hh"
+
+#if defined(__GNUC__) && !defined(__clang__)
+namespace akr
+{
+    // GCC 12 does not emit the digit tables local to std::to_chars when an importer is the first to instantiate it,
+    // so TupleFormat fails to link there. Instantiating every unsigned path here puts the tables into this unit.
+    void emitToCharsTables(char* first, char* last, unsigned long long value)
+    {
+        [&]<class... U>(std::tuple<U...>*)
+        {
+            (..., (std::to_chars(first, last, U(value), 10),
+                   std::to_chars(first, last, U(value), 16),
+                   std::to_chars(first, last, U(value), 36)));
+        }
+        (static_cast<std::tuple<unsigned, unsigned long, unsigned long long>*>(nullptr));
+    }
+}
+#endif
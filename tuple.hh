@@ -1,13 +1,182 @@
 #ifndef Z_AKR_TUPLE_HH
 #define Z_AKR_TUPLE_HH
 
+#include <array>
+#include <cstdint>
+#include <new>
+#include <span>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
 
+#ifdef  D_AKR_TUPLE_MODULE
+#define U_AKR_TUPLE_EXPORT export
+#else
+#define U_AKR_TUPLE_EXPORT
+#endif
+
+#ifdef  D_AKR_TUPLE_TRACE
+#include <tuple>
+
+#define U_AKR_TUPLE_TRACE_SCOPE(AKR_KIND) \
+        const auto u_akr_tuple_trace_scope = ::akr::TupleTrace::Scope(::akr::TupleTrace::Kind::AKR_KIND)
+
+#define U_AKR_TUPLE_TRACE(AKR_KIND, AKR_TYPE, ...) \
+        ::akr::TupleTrace::Record<AKR_TYPE, __VA_ARGS__>(::akr::TupleTrace::Kind::AKR_KIND)
+
+#define U_AKR_TUPLE_TRACE_PIECEWISE(AKR_KIND, AKR_TYPE, ...) \
+        ::akr::TupleTrace::RecordPiecewise<AKR_TYPE, __VA_ARGS__>(::akr::TupleTrace::Kind::AKR_KIND)
+#else
+#define U_AKR_TUPLE_TRACE_SCOPE(AKR_KIND)
+#define U_AKR_TUPLE_TRACE(AKR_KIND, AKR_TYPE, ...)
+#define U_AKR_TUPLE_TRACE_PIECEWISE(AKR_KIND, AKR_TYPE, ...)
+#endif
+
 namespace akr
 {
-    template<class... T>
+#ifdef  D_AKR_TUPLE_TRACE
+    U_AKR_TUPLE_EXPORT struct TupleTrace final
+    {
+        public:
+        enum class Kind : std::uint8_t
+        {
+            Construct, Convert, Assign, Append, Combine, Concat, Emplace
+        };
+
+        struct Counts final
+        {
+            public:
+            std::size_t copies = 0;
+
+            std::size_t moves = 0;
+
+            std::size_t constructions = 0;
+        };
+
+        private:
+        inline static constexpr std::size_t KindCount = 7;
+
+        struct State final
+        {
+            public:
+            Counts counts[KindCount] {};
+
+            Kind active {};
+
+            bool scoped = false;
+        };
+
+        static auto state() noexcept -> State&
+        {
+            thread_local auto state = State();
+
+            return state;
+        }
+
+        public:
+        struct Scope final
+        {
+            private:
+            bool owner = false;
+
+            public:
+            explicit constexpr Scope(Kind kind) noexcept
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    auto&& state = TupleTrace::state();
+
+                    if (!state.scoped)
+                    {
+                        state.active = kind;
+                        state.scoped = true;
+
+                        owner = true;
+                    }
+                }
+            }
+
+            Scope(const Scope&) = delete;
+
+            constexpr ~Scope()
+            {
+                if (!std::is_constant_evaluated() && owner)
+                {
+                    TupleTrace::state().scoped = false;
+                }
+            }
+        };
+
+        public:
+        template<class T, class... A>
+        static constexpr void Record(Kind kind) noexcept
+        {
+            if (!std::is_constant_evaluated())
+            {
+                auto&& state  = TupleTrace::state();
+                auto&& counts = state.counts[static_cast<std::size_t>(state.scoped ? state.active : kind)];
+
+                (..., (std::is_same_v<std::remove_cvref_t<A>, T>
+                           ? (std::is_rvalue_reference_v<A&&> && !std::is_const_v<std::remove_reference_t<A>> ? ++counts.moves : ++counts.copies)
+                           : ++counts.constructions));
+            }
+        }
+
+        // Records one T per argument tuple A, built from that tuple's elements as std::make_from_tuple would: a copy
+        // or move when the tuple holds a single T, a construction otherwise.
+        template<class T, class... A>
+        static constexpr void RecordPiecewise(Kind kind) noexcept
+        {
+            (..., recordFrom<T, A>(kind, std::make_index_sequence<std::tuple_size_v<std::remove_reference_t<A>>>()));
+        }
+
+        private:
+        template<class T, class A, std::size_t... I>
+        static constexpr void recordFrom(Kind kind, std::index_sequence<I...>) noexcept
+        {
+            if constexpr (sizeof...(I) == 1)
+            {
+                Record<T, decltype(std::get<I>(std::declval<A>()))...>(kind);
+            }
+            else if (!std::is_constant_evaluated())
+            {
+                auto&& state = TupleTrace::state();
+
+                ++state.counts[static_cast<std::size_t>(state.scoped ? state.active : kind)].constructions;
+            }
+        }
+
+        public:
+        static auto Of(Kind kind) noexcept -> Counts
+        {
+            return TupleTrace::state().counts[static_cast<std::size_t>(kind)];
+        }
+
+        static auto Total() noexcept -> Counts
+        {
+            auto result = Counts();
+
+            for (auto&& e : TupleTrace::state().counts)
+            {
+                result.copies        += e.copies;
+                result.moves         += e.moves;
+                result.constructions += e.constructions;
+            }
+
+            return result;
+        }
+
+        static void Reset() noexcept
+        {
+            for (auto&& e : TupleTrace::state().counts)
+            {
+                e = Counts();
+            }
+        }
+    };
+#endif
+
+    U_AKR_TUPLE_EXPORT template<class... T>
     struct Tuple;
 
     template<class T>
@@ -26,44 +195,95 @@ namespace akr
             inline static constexpr std::size_t Count = sizeof...(V);
         };
 
-        public:
-        struct Extract final
+        template<template<class...> class U, class... V>
+        struct IsHomogeneousHelper
         {
-            private:
-            template<template<class...> class U, class V, class... W>
-            struct ExtractHelper;
-
-            template<template<class...> class U, class V, class... W>
-            struct ExtractHelper<U, U<V, W...>> final
-            {
-                public:
-                using FirstType = V;
-
-                using TupleBase = U<W...>;
-            };
-
             public:
-            using FirstType = typename ExtractHelper<Tuple, std::decay_t<T>>::FirstType;
+            inline static constexpr bool Value = false;
+        };
 
-            using TupleBase = typename ExtractHelper<Tuple, std::decay_t<T>>::TupleBase;
+        template<template<class...> class U, class V, class... W>
+        struct IsHomogeneousHelper<U, U<V, W...>> final
+        {
+            public:
+            inline static constexpr bool Value = sizeof...(W) != 0 && (... && std::is_same_v<V, W>);
         };
 
+        public:
+        template<std::size_t I>
+        using ElementType = std::remove_reference_t<decltype(std::declval<std::decay_t<T>&>().template IndexOf<I>())>;
+
+        template<std::size_t I>
+        using ForwardType = std::conditional_t<std::is_rvalue_reference_v<T&&>,
+            ElementType<I>&&, const ElementType<I>&>;
+
         public:
         inline static constexpr bool IsTuple = std::is_final_v<IsTupleHelper<Tuple, std::decay_t<T>>>;
 
+        inline static constexpr bool IsHomogeneous = IsHomogeneousHelper<Tuple, std::decay_t<T>>::Value;
+
         public:
         static consteval auto CountOf() noexcept -> std::size_t
         {
             return IsTupleHelper<Tuple, std::decay_t<T>>::Count;
         }
+
+        // Whether Make<E> on a std::tuple-like T cannot throw.
+        template<class E>
+        static consteval auto IsNothrowMakeable() noexcept -> bool
+        {
+            return []<std::size_t... I_>(std::index_sequence<I_...>)
+            {
+                return std::is_nothrow_constructible_v<E, decltype(get<I_>(std::declval<T>()))...>;
+            }
+            (std::make_index_sequence<std::tuple_size<std::remove_reference_t<T>>::value>());
+        }
+
+        // std::make_from_tuple without <tuple>: get is found by argument-dependent lookup, so whoever built the
+        // std::tuple-like argument has already included its header.
+        template<class E>
+        static constexpr auto Make(T&& args) noexcept(IsNothrowMakeable<E>()) -> E
+        {
+            return [&]<std::size_t... I_>(std::index_sequence<I_...>) constexpr -> E
+            {
+                return E(get<I_>(std::forward<T>(args))...);
+            }
+            (std::make_index_sequence<std::tuple_size<std::remove_reference_t<T>>::value>());
+        }
     };
 
     template<>
     struct Tuple<>
     {
+        template<class... T>
+        friend struct Tuple;
+
+        private:
+        struct FromTuple final
+        {
+        };
+
         public:
         static constexpr auto Count = 0;
 
+        public:
+        constexpr Tuple() = default;
+
+        explicit constexpr Tuple(std::piecewise_construct_t) noexcept
+        {
+        }
+
+        private:
+        template<class V>
+        constexpr Tuple(FromTuple, V&&, std::index_sequence<>) noexcept
+        {
+        }
+
+        template<class V>
+        constexpr void assign(V&&, std::index_sequence<>) noexcept
+        {
+        }
+
         public:
         template<class T, class U>
         requires(TupleHelper<T>::IsTuple)
@@ -71,6 +291,8 @@ namespace akr
             noexcept(std::is_nothrow_constructible_v<T, const T&>
                      && (std::is_nothrow_constructible_v<std::decay_t<U>, U&&>))
         {
+            U_AKR_TUPLE_TRACE_SCOPE(Append);
+
             return std::forward<T>(lhs) + Tuple<>::Create(std::forward<U>(rhs));
         }
 
@@ -80,6 +302,8 @@ namespace akr
             noexcept(std::is_nothrow_constructible_v<T, const T&>
                      && (std::is_nothrow_constructible_v<std::decay_t<U>, U&&>))
         {
+            U_AKR_TUPLE_TRACE_SCOPE(Combine);
+
             return Tuple<>::combine<0, TupleHelper<T>::CountOf(), 0, TupleHelper<U>::CountOf()>(
                 std::forward<T>(lhs), std::forward<U>(rhs));
         }
@@ -89,6 +313,8 @@ namespace akr
         static constexpr auto Concat(T&&... values)
             noexcept((... && std::is_nothrow_constructible_v<std::decay_t<T>, T&&>))
         {
+            U_AKR_TUPLE_TRACE_SCOPE(Concat);
+
             return (... + toTuple(std::forward<T>(values)));
         }
 
@@ -99,6 +325,131 @@ namespace akr
             return Tuple<std::decay_t<T>...>(std::forward<T>(values)...);
         }
 
+        template<class T, class F>
+        requires(TupleHelper<T>::IsTuple)
+        static constexpr auto Map(T&& tuple, const F& func)
+        {
+            if constexpr (Tuple<>::isPacked<F, T>())
+            {
+                auto result = std::decay_t<T>();
+
+                auto&& lhs = result.Span();
+                auto&& rhs = tuple .Span();
+
+                for (std::size_t i = 0; i != lhs.size(); ++i)
+                {
+                    lhs[i] = func(rhs[i]);
+                }
+
+                return result;
+            }
+            else
+            {
+                return [&]<std::size_t... I_>(std::index_sequence<I_...>) constexpr
+                {
+                    return Tuple<>::Create(func(tuple.template IndexOf<I_>())...);
+                }
+                (std::make_index_sequence<TupleHelper<T>::CountOf()>{});
+            }
+        }
+
+        template<class T1, class T2, class F>
+        requires(TupleHelper<T1>::IsTuple && TupleHelper<T2>::IsTuple
+                 && TupleHelper<T1>::CountOf() == TupleHelper<T2>::CountOf())
+        static constexpr auto Zip(T1&& tuple1, T2&& tuple2, const F& func)
+        {
+            if constexpr (Tuple<>::isPacked<F, T1, T2>())
+            {
+                auto result = std::decay_t<T1>();
+
+                auto&& lhs  = result.Span();
+                auto&& rhs1 = tuple1.Span();
+                auto&& rhs2 = tuple2.Span();
+
+                for (std::size_t i = 0; i != lhs.size(); ++i)
+                {
+                    lhs[i] = func(rhs1[i], rhs2[i]);
+                }
+
+                return result;
+            }
+            else
+            {
+                return [&]<std::size_t... I_>(std::index_sequence<I_...>) constexpr
+                {
+                    return Tuple<>::Create(func(tuple1.template IndexOf<I_>(), tuple2.template IndexOf<I_>())...);
+                }
+                (std::make_index_sequence<TupleHelper<T1>::CountOf()>{});
+            }
+        }
+
+        template<class T1, class T2>
+        requires(TupleHelper<T1>::IsTuple && TupleHelper<T2>::IsTuple
+                 && TupleHelper<T1>::CountOf() == TupleHelper<T2>::CountOf())
+        static constexpr auto Add(T1&& tuple1, T2&& tuple2)
+        {
+            return Tuple<>::Zip(tuple1, tuple2, [](const auto& lhs, const auto& rhs) constexpr
+            {
+                return static_cast<std::common_type_t<decltype(lhs), decltype(rhs)>>(lhs + rhs);
+            });
+        }
+
+        template<class T1, class T2>
+        requires(TupleHelper<T1>::IsTuple && TupleHelper<T2>::IsTuple
+                 && TupleHelper<T1>::CountOf() == TupleHelper<T2>::CountOf())
+        static constexpr auto Subtract(T1&& tuple1, T2&& tuple2)
+        {
+            return Tuple<>::Zip(tuple1, tuple2, [](const auto& lhs, const auto& rhs) constexpr
+            {
+                return static_cast<std::common_type_t<decltype(lhs), decltype(rhs)>>(lhs - rhs);
+            });
+        }
+
+        template<class T1, class T2>
+        requires(TupleHelper<T1>::IsTuple && TupleHelper<T2>::IsTuple
+                 && TupleHelper<T1>::CountOf() == TupleHelper<T2>::CountOf())
+        static constexpr auto Multiply(T1&& tuple1, T2&& tuple2)
+        {
+            return Tuple<>::Zip(tuple1, tuple2, [](const auto& lhs, const auto& rhs) constexpr
+            {
+                return static_cast<std::common_type_t<decltype(lhs), decltype(rhs)>>(lhs * rhs);
+            });
+        }
+
+        template<class T1, class T2>
+        requires(TupleHelper<T1>::IsTuple && TupleHelper<T2>::IsTuple
+                 && TupleHelper<T1>::CountOf() == TupleHelper<T2>::CountOf())
+        static constexpr auto Divide(T1&& tuple1, T2&& tuple2)
+        {
+            return Tuple<>::Zip(tuple1, tuple2, [](const auto& lhs, const auto& rhs) constexpr
+            {
+                return static_cast<std::common_type_t<decltype(lhs), decltype(rhs)>>(lhs / rhs);
+            });
+        }
+
+        template<std::size_t... K, class T, std::size_t N>
+        requires(TupleHelper<T>::IsTuple && (... && (K < TupleHelper<T>::CountOf())))
+        static constexpr auto Sort(std::array<T, N> table) -> std::array<T, N>
+        {
+            using Keys = std::conditional_t<sizeof...(K) == 0,
+                std::make_index_sequence<TupleHelper<T>::CountOf()>, std::index_sequence<K...>>;
+
+            // A heap sort instead of std::sort keeps <algorithm> out of this header; neither is stable.
+            for (auto i = N / 2; i-- != 0;)
+            {
+                Tuple<>::siftDown(table, i, N, Keys());
+            }
+
+            for (auto i = N; i-- > 1;)
+            {
+                std::swap(table[0], table[i]);
+
+                Tuple<>::siftDown(table, 0, i, Keys());
+            }
+
+            return table;
+        }
+
         protected:
         template<class F>
         constexpr void ForEach(const F&)       noexcept
@@ -111,6 +462,58 @@ namespace akr
         }
 
         private:
+        template<class E, class... A>
+        static consteval auto isNothrowEmplace() noexcept -> bool
+        {
+            return std::is_nothrow_constructible_v<E, A...> || !std::is_nothrow_default_constructible_v<E>;
+        }
+
+        // Destroys element and constructs the new one in its place. If that constructor throws, the element is
+        // value-initialized again and the exception propagates; when E cannot be value-initialized without throwing,
+        // the tuple could not be left destructible, so Emplace is noexcept and std::terminate is called instead.
+        // Placement new is not a constant expression, so constant evaluation move-assigns a new element instead.
+        template<class E, class... A>
+        static constexpr auto emplace(E& element, A&&... args) noexcept(Tuple<>::isNothrowEmplace<E, A&&...>()) -> E&
+        {
+            if constexpr (std::is_move_assignable_v<E>)
+            {
+                if (std::is_constant_evaluated())
+                {
+                    element = E(std::forward<A>(args)...);
+
+                    return element;
+                }
+            }
+
+            auto address = const_cast<void*>(static_cast<const volatile void*>(__builtin_addressof(element)));
+
+            element.~E();
+
+            auto result = static_cast<E*>(nullptr);
+
+            if constexpr (Tuple<>::isNothrowEmplace<E, A&&...>())
+            {
+                result = ::new (address) E(std::forward<A>(args)...);
+            }
+            else
+            {
+                try
+                {
+                    result = ::new (address) E(std::forward<A>(args)...);
+                }
+                catch (...)
+                {
+                    ::new (address) E();
+
+                    throw;
+                }
+            }
+
+            U_AKR_TUPLE_TRACE_PIECEWISE(Emplace, E, std::tuple<A&&...>);
+
+            return *result;
+        }
+
         template<std::size_t B1, std::size_t E1, std::size_t B2, std::size_t E2, class T1, class T2, class... V>
         static constexpr auto combine(T1&& tuple1 [[maybe_unused]], T2&& tuple2 [[maybe_unused]], V&&... values)
             noexcept(std::is_nothrow_constructible_v<std::decay_t<T1>, T1&&>
@@ -120,13 +523,13 @@ namespace akr
             {
                 return Tuple<>::combine<B1 + 1, E1, B2, E2>(
                     std::forward<T1>(tuple1), std::forward<T2>(tuple2), std::forward<V>(values)...,
-                    tuple1.template IndexOf<B1>());
+                    static_cast<typename TupleHelper<T1&&>::template ForwardType<B1>>(tuple1.template IndexOf<B1>()));
             }
             else if constexpr (B2 != E2)
             {
                 return Tuple<>::combine<B1, E1, B2 + 1, E2>(
                     std::forward<T1>(tuple1), std::forward<T2>(tuple2), std::forward<V>(values)...,
-                    tuple2.template IndexOf<B2>());
+                    static_cast<typename TupleHelper<T2&&>::template ForwardType<B2>>(tuple2.template IndexOf<B2>()));
             }
             else
             {
@@ -134,6 +537,53 @@ namespace akr
             }
         }
 
+        template<class T, std::size_t... I>
+        static constexpr auto less(const T& lhs, const T& rhs, std::index_sequence<I...>) -> bool
+        {
+            auto result = false;
+
+            (void)(... || ((lhs.template IndexOf<I>() < rhs.template IndexOf<I>()) ? (result = true) :
+                           (rhs.template IndexOf<I>() < lhs.template IndexOf<I>())));
+
+            return result;
+        }
+
+        template<class T, std::size_t N, class K>
+        static constexpr void siftDown(std::array<T, N>& table, std::size_t root, std::size_t size, K keys)
+        {
+            for (auto child = root * 2 + 1; child < size; root = child, child = root * 2 + 1)
+            {
+                if (child + 1 < size && Tuple<>::less(table[child], table[child + 1], keys))
+                {
+                    ++child;
+                }
+
+                if (!Tuple<>::less(table[root], table[child], keys))
+                {
+                    return;
+                }
+
+                std::swap(table[root], table[child]);
+            }
+        }
+
+        template<class F, class T, class... U>
+        static consteval auto isPacked() noexcept -> bool
+        {
+            if constexpr (TupleHelper<T>::IsHomogeneous && (... && std::is_same_v<std::decay_t<T>, std::decay_t<U>>))
+            {
+                using E = typename TupleHelper<T>::template ElementType<0>;
+
+                using R = std::invoke_result_t<const F&, const E&, std::conditional_t<true, const E&, U>...>;
+
+                return std::is_arithmetic_v<E> && std::is_same_v<E, std::remove_cvref_t<R>>;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
         template<class T>
         static constexpr auto toTuple(T&& value)
             noexcept(std::is_nothrow_constructible_v<std::decay_t<T>, T&&>)
@@ -156,13 +606,7 @@ namespace akr
         friend struct Tuple;
 
         private:
-        template<class V>
-        using TupleBase = std::conditional_t<std::is_rvalue_reference_v<V&&>,
-            typename TupleHelper<V>::Extract::TupleBase&&, const typename TupleHelper<V>::Extract::TupleBase&>;
-
-        template<class V>
-        using FirstType = std::conditional_t<std::is_rvalue_reference_v<V&&>,
-            typename TupleHelper<V>::Extract::FirstType&&, const typename TupleHelper<V>::Extract::FirstType&>;
+        using FromTuple = typename Tuple<>::FromTuple;
 
         protected:
         T value {};
@@ -179,15 +623,14 @@ namespace akr
             noexcept(std::is_nothrow_constructible_v<T, V&&>):
             value { std::forward<V>(value_) }
         {
+            U_AKR_TUPLE_TRACE(Construct, T, V&&);
         }
 
         template<class V>
         requires( TupleHelper<V>::IsTuple && Count == TupleHelper<V>::CountOf())
         constexpr Tuple(V&& value_)
-            noexcept(std::is_nothrow_constructible_v<T, FirstType<V&&>>
-                     && std::is_nothrow_constructible_v<Tuple<U...>, TupleBase<V&&>>):
-            Tuple<U...>(static_cast<TupleBase<V&&>>(value_)),
-            value { static_cast<FirstType<V&&>>(value_.value) }
+            noexcept(noexcept(Tuple(FromTuple(), std::declval<V&&>(), std::make_index_sequence<Count>()))):
+            Tuple(FromTuple(), std::forward<V>(value_), std::make_index_sequence<Count>())
         {
         }
 
@@ -199,24 +642,58 @@ namespace akr
             Tuple<U...>(std::forward<W>(values)...),
             value { std::forward<V>(value_) }
         {
+            U_AKR_TUPLE_TRACE(Construct, T, V&&);
+        }
+
+        template<class A, class... B>
+        requires(sizeof...(B) + 1 == Count)
+        explicit constexpr Tuple(std::piecewise_construct_t, A&& args, B&&... rest)
+            noexcept(TupleHelper<A>::template IsNothrowMakeable<T>()
+                     && std::is_nothrow_constructible_v<Tuple<U...>, std::piecewise_construct_t, B&&...>):
+            Tuple<U...>(std::piecewise_construct, std::forward<B>(rest)...),
+            value(TupleHelper<A>::template Make<T>(std::forward<A>(args)))
+        {
+            U_AKR_TUPLE_TRACE_PIECEWISE(Construct, T, A&&);
+        }
+
+        private:
+        template<class V, std::size_t I, std::size_t... J>
+        constexpr Tuple(FromTuple, V&& value_, std::index_sequence<I, J...>)
+            noexcept(std::is_nothrow_constructible_v<T, typename TupleHelper<V&&>::template ForwardType<I>>
+                     && noexcept(Tuple<U...>(FromTuple(), std::declval<V&&>(), std::index_sequence<J...>()))):
+            Tuple<U...>(FromTuple(), std::forward<V>(value_), std::index_sequence<J...>()),
+            value { static_cast<typename TupleHelper<V&&>::template ForwardType<I>>(value_.template IndexOf<I>()) }
+        {
+            U_AKR_TUPLE_TRACE(Convert, T, typename TupleHelper<V&&>::template ForwardType<I>);
         }
 
         public:
         template<class V>
         requires( TupleHelper<V>::IsTuple && Count == TupleHelper<V>::CountOf())
         constexpr auto operator=(V&& rhs)
-            noexcept(std::is_nothrow_assignable_v<T, FirstType<V&&>>
-                     && std::is_nothrow_assignable_v<Tuple<U...>, TupleBase<V&&>>) -> Tuple&
+            noexcept(noexcept(std::declval<Tuple&>().assign(std::declval<V&&>(), std::make_index_sequence<Count>())))
+            -> Tuple&
         {
             auto&& lhs = *this;
 
-            static_cast<Tuple<U...>&>(lhs) = static_cast<TupleBase<V&&>>(rhs);
-
-            value = { static_cast<FirstType<V&&>>(rhs.value) };
+            lhs.assign(std::forward<V>(rhs), std::make_index_sequence<Count>());
 
             return lhs;
         }
 
+        private:
+        template<class V, std::size_t I, std::size_t... J>
+        constexpr void assign(V&& rhs, std::index_sequence<I, J...>)
+            noexcept(std::is_nothrow_assignable_v<T&, typename TupleHelper<V&&>::template ForwardType<I>>
+                     && noexcept(std::declval<Tuple<U...>&>().assign(std::declval<V&&>(), std::index_sequence<J...>())))
+        {
+            Tuple<U...>::assign(std::forward<V>(rhs), std::index_sequence<J...>());
+
+            value = { static_cast<typename TupleHelper<V&&>::template ForwardType<I>>(rhs.template IndexOf<I>()) };
+
+            U_AKR_TUPLE_TRACE(Assign, T, typename TupleHelper<V&&>::template ForwardType<I>);
+        }
+
         public:
         template<class F>
         constexpr void ForEach(const F& func)
@@ -268,6 +745,13 @@ namespace akr
             }
         }
 
+        template<std::size_t I, class... A, class E = typename TupleHelper<Tuple>::template ElementType<I>>
+        requires(I < Count && std::is_constructible_v<E, A&&...>)
+        constexpr auto Emplace(A&&... args) noexcept(Tuple<>::isNothrowEmplace<E, A&&...>()) -> E&
+        {
+            return Tuple<>::emplace(IndexOf<I>(), std::forward<A>(args)...);
+        }
+
         public:
         template<class F>
         constexpr void ForEach(const F& func) const
@@ -320,15 +804,185 @@ namespace akr
         }
     };
 
-    template<class V>
+    template<class T, class... U>
+    requires(sizeof...(U) != 0 && (... && std::is_same_v<T, U>))
+    struct Tuple<T, U...>: Tuple<>
+    {
+        template<class... V>
+        friend struct Tuple;
+
+        private:
+        using FromTuple = typename Tuple<>::FromTuple;
+
+        public:
+        static constexpr auto Count = sizeof...(U) + 1;
+
+        protected:
+        T value[Count] {};
+
+        public:
+        // User-provided rather than defaulted: GCC 12 does not emit the implicit constructor of an imported
+        // specialization with an array member, which fails to link at -O0 through 'import akr.tuple;'.
+        constexpr Tuple() noexcept(std::is_nothrow_default_constructible_v<T>)
+        {
+        }
+
+        template<class V>
+        requires( TupleHelper<V>::IsTuple && Count == TupleHelper<V>::CountOf())
+        constexpr Tuple(V&& value_)
+            noexcept(noexcept(Tuple(FromTuple(), std::declval<V&&>(), std::make_index_sequence<Count>()))):
+            Tuple(FromTuple(), std::forward<V>(value_), std::make_index_sequence<Count>())
+        {
+        }
+
+        template<class V, class... W>
+        requires(sizeof...(W) + 1 == Count)
+        explicit constexpr Tuple(V&& value_, W&&... values)
+            noexcept(std::is_nothrow_constructible_v<T, V&&>
+                     && (... && std::is_nothrow_constructible_v<T, W&&>)):
+            value { T { std::forward<V>(value_) }, T { std::forward<W>(values) }... }
+        {
+            U_AKR_TUPLE_TRACE(Construct, T, V&&, W&&...);
+        }
+
+        template<class... A>
+        requires(sizeof...(A) == Count)
+        explicit constexpr Tuple(std::piecewise_construct_t, A&&... args)
+            noexcept((... && TupleHelper<A>::template IsNothrowMakeable<T>())):
+            value { TupleHelper<A>::template Make<T>(std::forward<A>(args))... }
+        {
+            U_AKR_TUPLE_TRACE_PIECEWISE(Construct, T, A&&...);
+        }
+
+        private:
+        template<class V, std::size_t... I>
+        constexpr Tuple(FromTuple, V&& value_ [[maybe_unused]], std::index_sequence<I...>)
+            noexcept((... && std::is_nothrow_constructible_v<T, typename TupleHelper<V&&>::template ForwardType<I>>)):
+            value { T { static_cast<typename TupleHelper<V&&>::template ForwardType<I>>(value_.template IndexOf<I>()) }... }
+        {
+            U_AKR_TUPLE_TRACE(Convert, T, typename TupleHelper<V&&>::template ForwardType<I>...);
+        }
+
+        public:
+        template<class V>
+        requires( TupleHelper<V>::IsTuple && Count == TupleHelper<V>::CountOf())
+        constexpr auto operator=(V&& rhs)
+            noexcept(noexcept(std::declval<Tuple&>().assign(std::declval<V&&>(), std::make_index_sequence<Count>())))
+            -> Tuple&
+        {
+            auto&& lhs = *this;
+
+            lhs.assign(std::forward<V>(rhs), std::make_index_sequence<Count>());
+
+            return lhs;
+        }
+
+        private:
+        template<class V, std::size_t... I>
+        constexpr void assign(V&& rhs [[maybe_unused]], std::index_sequence<I...>)
+            noexcept((... && std::is_nothrow_assignable_v<T&, typename TupleHelper<V&&>::template ForwardType<I>>))
+        {
+            constexpr auto offset = TupleHelper<V>::CountOf() - Count;
+
+            (..., (value[I - offset] = { static_cast<typename TupleHelper<V&&>::template ForwardType<I>>(
+                rhs.template IndexOf<I>()) }));
+
+            U_AKR_TUPLE_TRACE(Assign, T, typename TupleHelper<V&&>::template ForwardType<I>...);
+        }
+
+        public:
+        template<class F>
+        constexpr void ForEach(const F& func)
+            noexcept(noexcept(func(value[0])))
+        {
+            for (auto&& e : value)
+            {
+                func(e);
+            }
+        }
+
+        template<class F>
+        constexpr void IndexBy(std::size_t index, const F& func)
+        {
+            if (index < Count)
+            {
+                func(value[index]);
+            }
+            else
+            {
+                throw std::out_of_range("index out of range.");
+            }
+        }
+
+        template<std::size_t I>
+        requires(I < Count)
+        constexpr auto IndexOf()       noexcept ->       auto&
+        {
+            return value[I];
+        }
+
+        template<std::size_t I, class... A, class E = typename TupleHelper<Tuple>::template ElementType<I>>
+        requires(I < Count && std::is_constructible_v<E, A&&...>)
+        constexpr auto Emplace(A&&... args) noexcept(Tuple<>::isNothrowEmplace<E, A&&...>()) -> E&
+        {
+            return Tuple<>::emplace(IndexOf<I>(), std::forward<A>(args)...);
+        }
+
+        constexpr auto Span()          noexcept -> std::span<      T, Count>
+        {
+            return value;
+        }
+
+        public:
+        template<class F>
+        constexpr void ForEach(const F& func) const
+            noexcept(noexcept(func(value[0])))
+        {
+            for (auto&& e : value)
+            {
+                func(e);
+            }
+        }
+
+        template<class F>
+        constexpr void IndexBy(std::size_t index, const F& func) const
+        {
+            if (index < Count)
+            {
+                func(value[index]);
+            }
+            else
+            {
+                throw std::out_of_range("index out of range.");
+            }
+        }
+
+        template<std::size_t I>
+        requires(I < Count)
+        constexpr auto IndexOf() const noexcept -> const auto&
+        {
+            return value[I];
+        }
+
+        constexpr auto Span()    const noexcept -> std::span<const T, Count>
+        {
+            return value;
+        }
+    };
+
+    U_AKR_TUPLE_EXPORT template<class V>
     explicit Tuple(V&& value_)                -> Tuple<std::decay_t<V>>;
 
-    template<class V, class... W>
+    U_AKR_TUPLE_EXPORT template<class V, class... W>
     explicit Tuple(V&& value_, W&&... values) -> Tuple<std::decay_t<V>, std::decay_t<W>...>;
 }
 
 #ifdef  D_AKR_TEST
+#include <cstdint>
 #include <cstring>
+#include <string>
+#include <string_view>
+#include <tuple>
 
 namespace akr::test
 {
@@ -531,87 +1185,87 @@ namespace akr::test
         static_assert(t1.Count == 1);
         static_assert(std::is_same_v<Tuple<int>, decltype(t1)>);
         static_assert(std::is_same_v<int&, decltype(t1.IndexOf<0>())>);
-        assert(t1.IndexOf<0>() == 1);
+        AKR_CHECK(t1.IndexOf<0>() == 1);
 
         auto t11 = t1;
         static_assert(t11.Count == 1);
         static_assert(std::is_same_v<Tuple<int>, decltype(t11)>);
         static_assert(std::is_same_v<int&, decltype(t11.IndexOf<0>())>);
-        assert(t11.IndexOf<0>() == 1);
+        AKR_CHECK(t11.IndexOf<0>() == 1);
 
         t11.IndexOf<0>() = -1;
-        assert(t11.IndexOf<0>() == -1);
+        AKR_CHECK(t11.IndexOf<0>() == -1);
         t11.IndexBy(0, [](auto&& e) { e = 1; });
-        assert(t11.IndexOf<0>() == 1);
+        AKR_CHECK(t11.IndexOf<0>() == 1);
         t11.ForEach([](auto&& e) { e = 0; });
-        assert(t11.IndexOf<0>() == 0);
+        AKR_CHECK(t11.IndexOf<0>() == 0);
 
         t11 = t1;
         static_assert(t11.Count == 1);
         static_assert(std::is_same_v<Tuple<int>, decltype(t11)>);
         static_assert(std::is_same_v<int&, decltype(t11.IndexOf<0>())>);
-        assert(t11.IndexOf<0>() == 1);
+        AKR_CHECK(t11.IndexOf<0>() == 1);
 
         auto t111 = Tuple<long long>(1);
         static_assert(t111.Count == 1);
         static_assert(std::is_same_v<Tuple<long long>, decltype(t111)>);
         static_assert(std::is_same_v<long long&, decltype(t111.IndexOf<0>())>);
-        assert(t111.IndexOf<0>() == 1);
+        AKR_CHECK(t111.IndexOf<0>() == 1);
 
         auto t1111 = Tuple<long long>(t1);
         static_assert(t1111.Count == 1);
         static_assert(std::is_same_v<Tuple<long long>, decltype(t1111)>);
         static_assert(std::is_same_v<long long&, decltype(t1111.IndexOf<0>())>);
-        assert(t1111.IndexOf<0>() == 1);
+        AKR_CHECK(t1111.IndexOf<0>() == 1);
 
         t1111.IndexOf<0>() = -1;
-        assert(t1111.IndexOf<0>() == -1);
+        AKR_CHECK(t1111.IndexOf<0>() == -1);
         t1111.IndexBy(0, [](auto&& e) { e = 1; });
-        assert(t1111.IndexOf<0>() == 1);
+        AKR_CHECK(t1111.IndexOf<0>() == 1);
         t1111.ForEach([](auto&& e) { e = 0; });
-        assert(t1111.IndexOf<0>() == 0);
+        AKR_CHECK(t1111.IndexOf<0>() == 0);
 
         t1111 = t1;
         static_assert(t1111.Count == 1);
         static_assert(std::is_same_v<Tuple<long long>, decltype(t1111)>);
         static_assert(std::is_same_v<long long&, decltype(t1111.IndexOf<0>())>);
-        assert(t1111.IndexOf<0>() == 1);
+        AKR_CHECK(t1111.IndexOf<0>() == 1);
 
         auto t2 = Tuple(1, 2);
         static_assert(t2.Count == 2);
         static_assert(std::is_same_v<Tuple<int, int>, decltype(t2)>);
         static_assert(std::is_same_v<int&, decltype(t2.IndexOf<0>())>);
-        assert(t2.IndexOf<0>() == 1);
+        AKR_CHECK(t2.IndexOf<0>() == 1);
         static_assert(std::is_same_v<int&, decltype(t2.IndexOf<1>())>);
-        assert(t2.IndexOf<1>() == 2);
+        AKR_CHECK(t2.IndexOf<1>() == 2);
 
         auto t22 = t2;
         static_assert(t22.Count == 2);
         static_assert(std::is_same_v<Tuple<int, int>, decltype(t22)>);
         static_assert(std::is_same_v<int&, decltype(t22.IndexOf<0>())>);
-        assert(t22.IndexOf<0>() == 1);
+        AKR_CHECK(t22.IndexOf<0>() == 1);
         static_assert(std::is_same_v<int&, decltype(t22.IndexOf<1>())>);
-        assert(t22.IndexOf<1>() == 2);
+        AKR_CHECK(t22.IndexOf<1>() == 2);
 
         t22.IndexOf<0>() = -1;
-        assert(t22.IndexOf<0>() == -1);
+        AKR_CHECK(t22.IndexOf<0>() == -1);
         t22.IndexOf<1>() = -2;
-        assert(t22.IndexOf<1>() == -2);
+        AKR_CHECK(t22.IndexOf<1>() == -2);
         t22.IndexBy(0, [](auto&& e) { e = 1; });
-        assert(t22.IndexOf<0>() == 1);
+        AKR_CHECK(t22.IndexOf<0>() == 1);
         t22.IndexBy(1, [](auto&& e) { e = 2; });
-        assert(t22.IndexOf<1>() == 2);
+        AKR_CHECK(t22.IndexOf<1>() == 2);
         t22.ForEach([](auto&& e) { e = 0; });
-        assert(t22.IndexOf<0>() == 0);
-        assert(t22.IndexOf<1>() == 0);
+        AKR_CHECK(t22.IndexOf<0>() == 0);
+        AKR_CHECK(t22.IndexOf<1>() == 0);
 
         t22 = t2;
         static_assert(t22.Count == 2);
         static_assert(std::is_same_v<Tuple<int, int>, decltype(t22)>);
         static_assert(std::is_same_v<int&, decltype(t22.IndexOf<0>())>);
-        assert(t22.IndexOf<0>() == 1);
+        AKR_CHECK(t22.IndexOf<0>() == 1);
         static_assert(std::is_same_v<int&, decltype(t22.IndexOf<1>())>);
-        assert(t22.IndexOf<1>() == 2);
+        AKR_CHECK(t22.IndexOf<1>() == 2);
 
         using T22 = decltype(Tuple(1ll, 2ll));
 
@@ -619,84 +1273,84 @@ namespace akr::test
         static_assert(t222.Count == 2);
         static_assert(std::is_same_v<Tuple<long long, long long>, decltype(t222)>);
         static_assert(std::is_same_v<long long&, decltype(t222.IndexOf<0>())>);
-        assert(t222.IndexOf<0>() == 1);
+        AKR_CHECK(t222.IndexOf<0>() == 1);
         static_assert(std::is_same_v<long long&, decltype(t222.IndexOf<1>())>);
-        assert(t222.IndexOf<1>() == 2);
+        AKR_CHECK(t222.IndexOf<1>() == 2);
 
         auto t2222 = T22(t2);
         static_assert(t2222.Count == 2);
         static_assert(std::is_same_v<Tuple<long long, long long>, decltype(t2222)>);
         static_assert(std::is_same_v<long long&, decltype(t2222.IndexOf<0>())>);
-        assert(t2222.IndexOf<0>() == 1);
+        AKR_CHECK(t2222.IndexOf<0>() == 1);
         static_assert(std::is_same_v<long long&, decltype(t2222.IndexOf<1>())>);
-        assert(t2222.IndexOf<1>() == 2);
+        AKR_CHECK(t2222.IndexOf<1>() == 2);
 
         t2222.IndexOf<0>() = -1;
-        assert(t2222.IndexOf<0>() == -1);
+        AKR_CHECK(t2222.IndexOf<0>() == -1);
         t2222.IndexOf<1>() = -2;
-        assert(t2222.IndexOf<1>() == -2);
+        AKR_CHECK(t2222.IndexOf<1>() == -2);
         t2222.IndexBy(0, [](auto&& e) { e = 1; });
-        assert(t2222.IndexOf<0>() == 1);
+        AKR_CHECK(t2222.IndexOf<0>() == 1);
         t2222.IndexBy(1, [](auto&& e) { e = 2; });
-        assert(t2222.IndexOf<1>() == 2);
+        AKR_CHECK(t2222.IndexOf<1>() == 2);
         t2222.ForEach([](auto&& e) { e = 0; });
-        assert(t2222.IndexOf<0>() == 0);
-        assert(t2222.IndexOf<1>() == 0);
+        AKR_CHECK(t2222.IndexOf<0>() == 0);
+        AKR_CHECK(t2222.IndexOf<1>() == 0);
 
         t2222 = t2;
         static_assert(t2222.Count == 2);
         static_assert(std::is_same_v<Tuple<long long, long long>, decltype(t2222)>);
         static_assert(std::is_same_v<long long&, decltype(t2222.IndexOf<0>())>);
-        assert(t2222.IndexOf<0>() == 1);
+        AKR_CHECK(t2222.IndexOf<0>() == 1);
         static_assert(std::is_same_v<long long&, decltype(t2222.IndexOf<1>())>);
-        assert(t2222.IndexOf<1>() == 2);
+        AKR_CHECK(t2222.IndexOf<1>() == 2);
 
         auto t3 = Tuple(1, 2, 3);
         static_assert(t3.Count == 3);
         static_assert(std::is_same_v<Tuple<int, int, int>, decltype(t3)>);
         static_assert(std::is_same_v<int&, decltype(t3.IndexOf<0>())>);
-        assert(t3.IndexOf<0>() == 1);
+        AKR_CHECK(t3.IndexOf<0>() == 1);
         static_assert(std::is_same_v<int&, decltype(t3.IndexOf<1>())>);
-        assert(t3.IndexOf<1>() == 2);
+        AKR_CHECK(t3.IndexOf<1>() == 2);
         static_assert(std::is_same_v<int&, decltype(t3.IndexOf<2>())>);
-        assert(t3.IndexOf<2>() == 3);
+        AKR_CHECK(t3.IndexOf<2>() == 3);
 
         auto t33 = t3;
         static_assert(t33.Count == 3);
         static_assert(std::is_same_v<Tuple<int, int, int>, decltype(t33)>);
         static_assert(std::is_same_v<int&, decltype(t33.IndexOf<0>())>);
-        assert(t33.IndexOf<0>() == 1);
+        AKR_CHECK(t33.IndexOf<0>() == 1);
         static_assert(std::is_same_v<int&, decltype(t33.IndexOf<1>())>);
-        assert(t33.IndexOf<1>() == 2);
+        AKR_CHECK(t33.IndexOf<1>() == 2);
         static_assert(std::is_same_v<int&, decltype(t33.IndexOf<2>())>);
-        assert(t33.IndexOf<2>() == 3);
+        AKR_CHECK(t33.IndexOf<2>() == 3);
 
         t33.IndexOf<0>() = -1;
-        assert(t33.IndexOf<0>() == -1);
+        AKR_CHECK(t33.IndexOf<0>() == -1);
         t33.IndexOf<1>() = -2;
-        assert(t33.IndexOf<1>() == -2);
+        AKR_CHECK(t33.IndexOf<1>() == -2);
         t33.IndexOf<2>() = -3;
-        assert(t33.IndexOf<2>() == -3);
+        AKR_CHECK(t33.IndexOf<2>() == -3);
         t33.IndexBy(0, [](auto&& e) { e = 1; });
-        assert(t33.IndexOf<0>() == 1);
+        AKR_CHECK(t33.IndexOf<0>() == 1);
         t33.IndexBy(1, [](auto&& e) { e = 2; });
-        assert(t33.IndexOf<1>() == 2);
+        AKR_CHECK(t33.IndexOf<1>() == 2);
         t33.IndexBy(2, [](auto&& e) { e = 3; });
-        assert(t33.IndexOf<2>() == 3);
+        AKR_CHECK(t33.IndexOf<2>() == 3);
         t33.ForEach([](auto&& e) { e = 0; });
-        assert(t33.IndexOf<0>() == 0);
-        assert(t33.IndexOf<1>() == 0);
-        assert(t33.IndexOf<2>() == 0);
+        AKR_CHECK(t33.IndexOf<0>() == 0);
+        AKR_CHECK(t33.IndexOf<1>() == 0);
+        AKR_CHECK(t33.IndexOf<2>() == 0);
 
         t33 = t3;
         static_assert(t33.Count == 3);
         static_assert(std::is_same_v<Tuple<int, int, int>, decltype(t33)>);
         static_assert(std::is_same_v<int&, decltype(t33.IndexOf<0>())>);
-        assert(t33.IndexOf<0>() == 1);
+        AKR_CHECK(t33.IndexOf<0>() == 1);
         static_assert(std::is_same_v<int&, decltype(t33.IndexOf<1>())>);
-        assert(t33.IndexOf<1>() == 2);
+        AKR_CHECK(t33.IndexOf<1>() == 2);
         static_assert(std::is_same_v<int&, decltype(t33.IndexOf<2>())>);
-        assert(t33.IndexOf<2>() == 3);
+        AKR_CHECK(t33.IndexOf<2>() == 3);
 
         using T33 = decltype(Tuple(1ll, 2ll, 3ll));
 
@@ -704,48 +1358,48 @@ namespace akr::test
         static_assert(t333.Count == 3);
         static_assert(std::is_same_v<Tuple<long long, long long, long long>, decltype(t333)>);
         static_assert(std::is_same_v<long long&, decltype(t333.IndexOf<0>())>);
-        assert(t333.IndexOf<0>() == 1);
+        AKR_CHECK(t333.IndexOf<0>() == 1);
         static_assert(std::is_same_v<long long&, decltype(t333.IndexOf<1>())>);
-        assert(t333.IndexOf<1>() == 2);
+        AKR_CHECK(t333.IndexOf<1>() == 2);
         static_assert(std::is_same_v<long long&, decltype(t333.IndexOf<2>())>);
-        assert(t333.IndexOf<2>() == 3);
+        AKR_CHECK(t333.IndexOf<2>() == 3);
 
         auto t3333 = T33(t3);
         static_assert(t3333.Count == 3);
         static_assert(std::is_same_v<Tuple<long long, long long, long long>, decltype(t3333)>);
         static_assert(std::is_same_v<long long&, decltype(t3333.IndexOf<0>())>);
-        assert(t3333.IndexOf<0>() == 1);
+        AKR_CHECK(t3333.IndexOf<0>() == 1);
         static_assert(std::is_same_v<long long&, decltype(t3333.IndexOf<1>())>);
-        assert(t3333.IndexOf<1>() == 2);
+        AKR_CHECK(t3333.IndexOf<1>() == 2);
         static_assert(std::is_same_v<long long&, decltype(t3333.IndexOf<2>())>);
-        assert(t3333.IndexOf<2>() == 3);
+        AKR_CHECK(t3333.IndexOf<2>() == 3);
 
         t3333.IndexOf<0>() = -1;
-        assert(t3333.IndexOf<0>() == -1);
+        AKR_CHECK(t3333.IndexOf<0>() == -1);
         t3333.IndexOf<1>() = -2;
-        assert(t3333.IndexOf<1>() == -2);
+        AKR_CHECK(t3333.IndexOf<1>() == -2);
         t3333.IndexOf<2>() = -3;
-        assert(t3333.IndexOf<2>() == -3);
+        AKR_CHECK(t3333.IndexOf<2>() == -3);
         t3333.IndexBy(0, [](auto&& e) { e = 1; });
-        assert(t3333.IndexOf<0>() == 1);
+        AKR_CHECK(t3333.IndexOf<0>() == 1);
         t3333.IndexBy(1, [](auto&& e) { e = 2; });
-        assert(t3333.IndexOf<1>() == 2);
+        AKR_CHECK(t3333.IndexOf<1>() == 2);
         t3333.IndexBy(2, [](auto&& e) { e = 3; });
-        assert(t3333.IndexOf<2>() == 3);
+        AKR_CHECK(t3333.IndexOf<2>() == 3);
         t3333.ForEach([](auto&& e) { e = 0; });
-        assert(t3333.IndexOf<0>() == 0);
-        assert(t3333.IndexOf<1>() == 0);
-        assert(t3333.IndexOf<2>() == 0);
+        AKR_CHECK(t3333.IndexOf<0>() == 0);
+        AKR_CHECK(t3333.IndexOf<1>() == 0);
+        AKR_CHECK(t3333.IndexOf<2>() == 0);
 
         t3333 = t3;
         static_assert(t3333.Count == 3);
         static_assert(std::is_same_v<Tuple<long long, long long, long long>, decltype(t3333)>);
         static_assert(std::is_same_v<long long&, decltype(t3333.IndexOf<0>())>);
-        assert(t3333.IndexOf<0>() == 1);
+        AKR_CHECK(t3333.IndexOf<0>() == 1);
         static_assert(std::is_same_v<long long&, decltype(t3333.IndexOf<1>())>);
-        assert(t3333.IndexOf<1>() == 2);
+        AKR_CHECK(t3333.IndexOf<1>() == 2);
         static_assert(std::is_same_v<long long&, decltype(t3333.IndexOf<2>())>);
-        assert(t3333.IndexOf<2>() == 3);
+        AKR_CHECK(t3333.IndexOf<2>() == 3);
 
         using T4 = decltype(Tuple(true, 'A', 123, 3.14, "ABC", nullptr));
 
@@ -753,62 +1407,62 @@ namespace akr::test
         static_assert(t4.Count == 6);
         static_assert(std::is_same_v<T4, decltype(t4)>);
         static_assert(std::is_same_v<bool&, decltype(t4.IndexOf<0>())>);
-        assert(t4.IndexOf<0>() == true);
+        AKR_CHECK(t4.IndexOf<0>() == true);
         static_assert(std::is_same_v<char&, decltype(t4.IndexOf<1>())>);
-        assert(t4.IndexOf<1>() == 'A');
+        AKR_CHECK(t4.IndexOf<1>() == 'A');
         static_assert(std::is_same_v<int&, decltype(t4.IndexOf<2>())>);
-        assert(t4.IndexOf<2>() == 123);
+        AKR_CHECK(t4.IndexOf<2>() == 123);
         static_assert(std::is_same_v<double&, decltype(t4.IndexOf<3>())>);
-        assert(t4.IndexOf<3>() == 3.14);
+        AKR_CHECK(t4.IndexOf<3>() == 3.14);
         static_assert(std::is_same_v<const char*&, decltype(t4.IndexOf<4>())>);
-        assert(!std::strcmp(t4.IndexOf<4>(), "ABC"));
+        AKR_CHECK(!std::strcmp(t4.IndexOf<4>(), "ABC"));
         static_assert(std::is_same_v<std::nullptr_t&, decltype(t4.IndexOf<5>())>);
-        assert(t4.IndexOf<5>() == nullptr);
+        AKR_CHECK(t4.IndexOf<5>() == nullptr);
 
         auto t44 = t4;
         static_assert(t44.Count == 6);
         static_assert(std::is_same_v<T4, decltype(t44)>);
         static_assert(std::is_same_v<bool&, decltype(t44.IndexOf<0>())>);
-        assert(t44.IndexOf<0>() == true);
+        AKR_CHECK(t44.IndexOf<0>() == true);
         static_assert(std::is_same_v<char&, decltype(t44.IndexOf<1>())>);
-        assert(t44.IndexOf<1>() == 'A');
+        AKR_CHECK(t44.IndexOf<1>() == 'A');
         static_assert(std::is_same_v<int&, decltype(t44.IndexOf<2>())>);
-        assert(t44.IndexOf<2>() == 123);
+        AKR_CHECK(t44.IndexOf<2>() == 123);
         static_assert(std::is_same_v<double&, decltype(t44.IndexOf<3>())>);
-        assert(t44.IndexOf<3>() == 3.14);
+        AKR_CHECK(t44.IndexOf<3>() == 3.14);
         static_assert(std::is_same_v<const char*&, decltype(t44.IndexOf<4>())>);
-        assert(!std::strcmp(t44.IndexOf<4>(), "ABC"));
+        AKR_CHECK(!std::strcmp(t44.IndexOf<4>(), "ABC"));
         static_assert(std::is_same_v<std::nullptr_t&, decltype(t44.IndexOf<5>())>);
-        assert(t44.IndexOf<5>() == nullptr);
+        AKR_CHECK(t44.IndexOf<5>() == nullptr);
 
         t44.IndexOf<0>() = false;
-        assert(t44.IndexOf<0>() == false);
+        AKR_CHECK(t44.IndexOf<0>() == false);
         t44.IndexOf<1>() = 'a';
-        assert(t44.IndexOf<1>() == 'a');
+        AKR_CHECK(t44.IndexOf<1>() == 'a');
         t44.IndexOf<2>() = -123;
-        assert(t44.IndexOf<2>() == -123);
+        AKR_CHECK(t44.IndexOf<2>() == -123);
         t44.IndexOf<3>() = -3.14;
-        assert(t44.IndexOf<3>() == -3.14);
+        AKR_CHECK(t44.IndexOf<3>() == -3.14);
         t44.IndexOf<4>() = "abc";
-        assert(!std::strcmp(t44.IndexOf<4>(), "abc"));
+        AKR_CHECK(!std::strcmp(t44.IndexOf<4>(), "abc"));
         t44.IndexOf<5>() = nullptr;
-        assert(t44.IndexOf<5>() == nullptr);
+        AKR_CHECK(t44.IndexOf<5>() == nullptr);
 
         t44 = t4;
         static_assert(t44.Count == 6);
         static_assert(std::is_same_v<T4, decltype(t44)>);
         static_assert(std::is_same_v<bool&, decltype(t44.IndexOf<0>())>);
-        assert(t44.IndexOf<0>() == true);
+        AKR_CHECK(t44.IndexOf<0>() == true);
         static_assert(std::is_same_v<char&, decltype(t44.IndexOf<1>())>);
-        assert(t44.IndexOf<1>() == 'A');
+        AKR_CHECK(t44.IndexOf<1>() == 'A');
         static_assert(std::is_same_v<int&, decltype(t44.IndexOf<2>())>);
-        assert(t44.IndexOf<2>() == 123);
+        AKR_CHECK(t44.IndexOf<2>() == 123);
         static_assert(std::is_same_v<double&, decltype(t44.IndexOf<3>())>);
-        assert(t44.IndexOf<3>() == 3.14);
+        AKR_CHECK(t44.IndexOf<3>() == 3.14);
         static_assert(std::is_same_v<const char*&, decltype(t44.IndexOf<4>())>);
-        assert(!std::strcmp(t44.IndexOf<4>(), "ABC"));
+        AKR_CHECK(!std::strcmp(t44.IndexOf<4>(), "ABC"));
         static_assert(std::is_same_v<std::nullptr_t&, decltype(t44.IndexOf<5>())>);
-        assert(t44.IndexOf<5>() == nullptr);
+        AKR_CHECK(t44.IndexOf<5>() == nullptr);
 
         using T44 = decltype(Tuple(1, 2, 3ll, 3.14, std::string(), nullptr));
 
@@ -816,62 +1470,62 @@ namespace akr::test
         static_assert(t444.Count == 6);
         static_assert(std::is_same_v<T44, decltype(t444)>);
         static_assert(std::is_same_v<int&, decltype(t444.IndexOf<0>())>);
-        assert(t444.IndexOf<0>() == true);
+        AKR_CHECK(t444.IndexOf<0>() == true);
         static_assert(std::is_same_v<int&, decltype(t444.IndexOf<1>())>);
-        assert(t444.IndexOf<1>() == 'A');
+        AKR_CHECK(t444.IndexOf<1>() == 'A');
         static_assert(std::is_same_v<long long&, decltype(t444.IndexOf<2>())>);
-        assert(t444.IndexOf<2>() == 123);
+        AKR_CHECK(t444.IndexOf<2>() == 123);
         static_assert(std::is_same_v<double&, decltype(t444.IndexOf<3>())>);
-        assert(t444.IndexOf<3>() == 3.14);
+        AKR_CHECK(t444.IndexOf<3>() == 3.14);
         static_assert(std::is_same_v<std::string&, decltype(t444.IndexOf<4>())>);
-        assert(t444.IndexOf<4>() == "ABC");
+        AKR_CHECK(t444.IndexOf<4>() == "ABC");
         static_assert(std::is_same_v<std::nullptr_t&, decltype(t444.IndexOf<5>())>);
-        assert(t444.IndexOf<5>() == nullptr);
+        AKR_CHECK(t444.IndexOf<5>() == nullptr);
 
         auto t4444 = T44(t4);
         static_assert(t4444.Count == 6);
         static_assert(std::is_same_v<T44, decltype(t4444)>);
         static_assert(std::is_same_v<int&, decltype(t4444.IndexOf<0>())>);
-        assert(t4444.IndexOf<0>() == true);
+        AKR_CHECK(t4444.IndexOf<0>() == true);
         static_assert(std::is_same_v<int&, decltype(t4444.IndexOf<1>())>);
-        assert(t4444.IndexOf<1>() == 'A');
+        AKR_CHECK(t4444.IndexOf<1>() == 'A');
         static_assert(std::is_same_v<long long&, decltype(t4444.IndexOf<2>())>);
-        assert(t4444.IndexOf<2>() == 123);
+        AKR_CHECK(t4444.IndexOf<2>() == 123);
         static_assert(std::is_same_v<double&, decltype(t4444.IndexOf<3>())>);
-        assert(t4444.IndexOf<3>() == 3.14);
+        AKR_CHECK(t4444.IndexOf<3>() == 3.14);
         static_assert(std::is_same_v<std::string&, decltype(t4444.IndexOf<4>())>);
-        assert(t4444.IndexOf<4>() == "ABC");
+        AKR_CHECK(t4444.IndexOf<4>() == "ABC");
         static_assert(std::is_same_v<std::nullptr_t&, decltype(t4444.IndexOf<5>())>);
-        assert(t4444.IndexOf<5>() == nullptr);
+        AKR_CHECK(t4444.IndexOf<5>() == nullptr);
 
         t4444.IndexOf<0>() = false;
-        assert(t4444.IndexOf<0>() == false);
+        AKR_CHECK(t4444.IndexOf<0>() == false);
         t4444.IndexOf<1>() = 'a';
-        assert(t4444.IndexOf<1>() == 'a');
+        AKR_CHECK(t4444.IndexOf<1>() == 'a');
         t4444.IndexOf<2>() = -123;
-        assert(t4444.IndexOf<2>() == -123);
+        AKR_CHECK(t4444.IndexOf<2>() == -123);
         t4444.IndexOf<3>() = -3.14;
-        assert(t4444.IndexOf<3>() == -3.14);
+        AKR_CHECK(t4444.IndexOf<3>() == -3.14);
         t4444.IndexOf<4>() = "abc";
-        assert(t4444.IndexOf<4>() =="abc");
+        AKR_CHECK(t4444.IndexOf<4>() =="abc");
         t4444.IndexOf<5>() = nullptr;
-        assert(t4444.IndexOf<5>() == nullptr);
+        AKR_CHECK(t4444.IndexOf<5>() == nullptr);
 
         t4444 = t4;
         static_assert(t4444.Count == 6);
         static_assert(std::is_same_v<T44, decltype(t4444)>);
         static_assert(std::is_same_v<int&, decltype(t4444.IndexOf<0>())>);
-        assert(t4444.IndexOf<0>() == true);
+        AKR_CHECK(t4444.IndexOf<0>() == true);
         static_assert(std::is_same_v<int&, decltype(t4444.IndexOf<1>())>);
-        assert(t4444.IndexOf<1>() == 'A');
+        AKR_CHECK(t4444.IndexOf<1>() == 'A');
         static_assert(std::is_same_v<long long&, decltype(t4444.IndexOf<2>())>);
-        assert(t4444.IndexOf<2>() == 123);
+        AKR_CHECK(t4444.IndexOf<2>() == 123);
         static_assert(std::is_same_v<double&, decltype(t4444.IndexOf<3>())>);
-        assert(t4444.IndexOf<3>() == 3.14);
+        AKR_CHECK(t4444.IndexOf<3>() == 3.14);
         static_assert(std::is_same_v<std::string&, decltype(t4444.IndexOf<4>())>);
-        assert(t4444.IndexOf<4>() == "ABC");
+        AKR_CHECK(t4444.IndexOf<4>() == "ABC");
         static_assert(std::is_same_v<std::nullptr_t&, decltype(t4444.IndexOf<5>())>);
-        assert(t4444.IndexOf<5>() == nullptr);
+        AKR_CHECK(t4444.IndexOf<5>() == nullptr);
 
         auto u0 = Tuple<>::Create();
         static_assert(std::is_same_v<Tuple<>, decltype(u0)>);
@@ -881,87 +1535,87 @@ namespace akr::test
         static_assert(u1.Count == 1);
         static_assert(std::is_same_v<Tuple<int>, decltype(u1)>);
         static_assert(std::is_same_v<int&, decltype(u1.IndexOf<0>())>);
-        assert(u1.IndexOf<0>() == 1);
+        AKR_CHECK(u1.IndexOf<0>() == 1);
 
         auto u11 = u1;
         static_assert(u11.Count == 1);
         static_assert(std::is_same_v<Tuple<int>, decltype(u11)>);
         static_assert(std::is_same_v<int&, decltype(u11.IndexOf<0>())>);
-        assert(u11.IndexOf<0>() == 1);
+        AKR_CHECK(u11.IndexOf<0>() == 1);
 
         u11.IndexOf<0>() = -1;
-        assert(u11.IndexOf<0>() == -1);
+        AKR_CHECK(u11.IndexOf<0>() == -1);
         u11.IndexBy(0, [](auto&& e) { e = 1; });
-        assert(u11.IndexOf<0>() == 1);
+        AKR_CHECK(u11.IndexOf<0>() == 1);
         u11.ForEach([](auto&& e) { e = 0; });
-        assert(u11.IndexOf<0>() == 0);
+        AKR_CHECK(u11.IndexOf<0>() == 0);
 
         u11 = u1;
         static_assert(u11.Count == 1);
         static_assert(std::is_same_v<Tuple<int>, decltype(u11)>);
         static_assert(std::is_same_v<int&, decltype(u11.IndexOf<0>())>);
-        assert(u11.IndexOf<0>() == 1);
+        AKR_CHECK(u11.IndexOf<0>() == 1);
 
         Tuple<long long> u111 = Tuple<>::Create(1);
         static_assert(u111.Count == 1);
         static_assert(std::is_same_v<Tuple<long long>, decltype(u111)>);
         static_assert(std::is_same_v<long long&, decltype(u111.IndexOf<0>())>);
-        assert(u111.IndexOf<0>() == 1);
+        AKR_CHECK(u111.IndexOf<0>() == 1);
 
         Tuple<long long> u1111 = u1;
         static_assert(u1111.Count == 1);
         static_assert(std::is_same_v<Tuple<long long>, decltype(u1111)>);
         static_assert(std::is_same_v<long long&, decltype(u1111.IndexOf<0>())>);
-        assert(u1111.IndexOf<0>() == 1);
+        AKR_CHECK(u1111.IndexOf<0>() == 1);
 
         u1111.IndexOf<0>() = -1;
-        assert(u1111.IndexOf<0>() == -1);
+        AKR_CHECK(u1111.IndexOf<0>() == -1);
         u1111.IndexBy(0, [](auto&& e) { e = 1; });
-        assert(u1111.IndexOf<0>() == 1);
+        AKR_CHECK(u1111.IndexOf<0>() == 1);
         u1111.ForEach([](auto&& e) { e = 0; });
-        assert(u1111.IndexOf<0>() == 0);
+        AKR_CHECK(u1111.IndexOf<0>() == 0);
 
         u1111 = u1;
         static_assert(u1111.Count == 1);
         static_assert(std::is_same_v<Tuple<long long>, decltype(u1111)>);
         static_assert(std::is_same_v<long long&, decltype(u1111.IndexOf<0>())>);
-        assert(u1111.IndexOf<0>() == 1);
+        AKR_CHECK(u1111.IndexOf<0>() == 1);
 
         auto u2 = Tuple<>::Create(1, 2);
         static_assert(u2.Count == 2);
         static_assert(std::is_same_v<Tuple<int, int>, decltype(u2)>);
         static_assert(std::is_same_v<int&, decltype(u2.IndexOf<0>())>);
-        assert(u2.IndexOf<0>() == 1);
+        AKR_CHECK(u2.IndexOf<0>() == 1);
         static_assert(std::is_same_v<int&, decltype(u2.IndexOf<1>())>);
-        assert(u2.IndexOf<1>() == 2);
+        AKR_CHECK(u2.IndexOf<1>() == 2);
 
         auto u22 = u2;
         static_assert(u22.Count == 2);
         static_assert(std::is_same_v<Tuple<int, int>, decltype(u22)>);
         static_assert(std::is_same_v<int&, decltype(u22.IndexOf<0>())>);
-        assert(u22.IndexOf<0>() == 1);
+        AKR_CHECK(u22.IndexOf<0>() == 1);
         static_assert(std::is_same_v<int&, decltype(u22.IndexOf<1>())>);
-        assert(u22.IndexOf<1>() == 2);
+        AKR_CHECK(u22.IndexOf<1>() == 2);
 
         u22.IndexOf<0>() = -1;
-        assert(u22.IndexOf<0>() == -1);
+        AKR_CHECK(u22.IndexOf<0>() == -1);
         u22.IndexOf<1>() = -2;
-        assert(u22.IndexOf<1>() == -2);
+        AKR_CHECK(u22.IndexOf<1>() == -2);
         u22.IndexBy(0, [](auto&& e) { e = 1; });
-        assert(u22.IndexOf<0>() == 1);
+        AKR_CHECK(u22.IndexOf<0>() == 1);
         u22.IndexBy(1, [](auto&& e) { e = 2; });
-        assert(u22.IndexOf<1>() == 2);
+        AKR_CHECK(u22.IndexOf<1>() == 2);
         u22.ForEach([](auto&& e) { e = 0; });
-        assert(u22.IndexOf<0>() == 0);
-        assert(u22.IndexOf<1>() == 0);
+        AKR_CHECK(u22.IndexOf<0>() == 0);
+        AKR_CHECK(u22.IndexOf<1>() == 0);
 
         u22 = u2;
         static_assert(u22.Count == 2);
         static_assert(std::is_same_v<Tuple<int, int>, decltype(u22)>);
         static_assert(std::is_same_v<int&, decltype(u22.IndexOf<0>())>);
-        assert(u22.IndexOf<0>() == 1);
+        AKR_CHECK(u22.IndexOf<0>() == 1);
         static_assert(std::is_same_v<int&, decltype(u22.IndexOf<1>())>);
-        assert(u22.IndexOf<1>() == 2);
+        AKR_CHECK(u22.IndexOf<1>() == 2);
 
         using U22 = decltype(Tuple(1ll, 2ll));
 
@@ -969,84 +1623,84 @@ namespace akr::test
         static_assert(u222.Count == 2);
         static_assert(std::is_same_v<Tuple<long long, long long>, decltype(u222)>);
         static_assert(std::is_same_v<long long&, decltype(u222.IndexOf<0>())>);
-        assert(u222.IndexOf<0>() == 1);
+        AKR_CHECK(u222.IndexOf<0>() == 1);
         static_assert(std::is_same_v<long long&, decltype(u222.IndexOf<1>())>);
-        assert(u222.IndexOf<1>() == 2);
+        AKR_CHECK(u222.IndexOf<1>() == 2);
 
         auto u2222 = U22(u2);
         static_assert(u2222.Count == 2);
         static_assert(std::is_same_v<Tuple<long long, long long>, decltype(u2222)>);
         static_assert(std::is_same_v<long long&, decltype(u2222.IndexOf<0>())>);
-        assert(u2222.IndexOf<0>() == 1);
+        AKR_CHECK(u2222.IndexOf<0>() == 1);
         static_assert(std::is_same_v<long long&, decltype(u2222.IndexOf<1>())>);
-        assert(u2222.IndexOf<1>() == 2);
+        AKR_CHECK(u2222.IndexOf<1>() == 2);
 
         u2222.IndexOf<0>() = -1;
-        assert(u2222.IndexOf<0>() == -1);
+        AKR_CHECK(u2222.IndexOf<0>() == -1);
         u2222.IndexOf<1>() = -2;
-        assert(u2222.IndexOf<1>() == -2);
+        AKR_CHECK(u2222.IndexOf<1>() == -2);
         u2222.IndexBy(0, [](auto&& e) { e = 1; });
-        assert(u2222.IndexOf<0>() == 1);
+        AKR_CHECK(u2222.IndexOf<0>() == 1);
         u2222.IndexBy(1, [](auto&& e) { e = 2; });
-        assert(u2222.IndexOf<1>() == 2);
+        AKR_CHECK(u2222.IndexOf<1>() == 2);
         u2222.ForEach([](auto&& e) { e = 0; });
-        assert(u2222.IndexOf<0>() == 0);
-        assert(u2222.IndexOf<1>() == 0);
+        AKR_CHECK(u2222.IndexOf<0>() == 0);
+        AKR_CHECK(u2222.IndexOf<1>() == 0);
 
         u2222 = u2;
         static_assert(u2222.Count == 2);
         static_assert(std::is_same_v<Tuple<long long, long long>, decltype(u2222)>);
         static_assert(std::is_same_v<long long&, decltype(u2222.IndexOf<0>())>);
-        assert(u2222.IndexOf<0>() == 1);
+        AKR_CHECK(u2222.IndexOf<0>() == 1);
         static_assert(std::is_same_v<long long&, decltype(u2222.IndexOf<1>())>);
-        assert(u2222.IndexOf<1>() == 2);
+        AKR_CHECK(u2222.IndexOf<1>() == 2);
 
         auto u3 = Tuple<>::Create(1, 2, 3);
         static_assert(u3.Count == 3);
         static_assert(std::is_same_v<Tuple<int, int, int>, decltype(u3)>);
         static_assert(std::is_same_v<int&, decltype(u3.IndexOf<0>())>);
-        assert(u3.IndexOf<0>() == 1);
+        AKR_CHECK(u3.IndexOf<0>() == 1);
         static_assert(std::is_same_v<int&, decltype(u3.IndexOf<1>())>);
-        assert(u3.IndexOf<1>() == 2);
+        AKR_CHECK(u3.IndexOf<1>() == 2);
         static_assert(std::is_same_v<int&, decltype(u3.IndexOf<2>())>);
-        assert(u3.IndexOf<2>() == 3);
+        AKR_CHECK(u3.IndexOf<2>() == 3);
 
         auto u33 = u3;
         static_assert(u33.Count == 3);
         static_assert(std::is_same_v<Tuple<int, int, int>, decltype(u33)>);
         static_assert(std::is_same_v<int&, decltype(u33.IndexOf<0>())>);
-        assert(u33.IndexOf<0>() == 1);
+        AKR_CHECK(u33.IndexOf<0>() == 1);
         static_assert(std::is_same_v<int&, decltype(u33.IndexOf<1>())>);
-        assert(u33.IndexOf<1>() == 2);
+        AKR_CHECK(u33.IndexOf<1>() == 2);
         static_assert(std::is_same_v<int&, decltype(u33.IndexOf<2>())>);
-        assert(u33.IndexOf<2>() == 3);
+        AKR_CHECK(u33.IndexOf<2>() == 3);
 
         u33.IndexOf<0>() = -1;
-        assert(u33.IndexOf<0>() == -1);
+        AKR_CHECK(u33.IndexOf<0>() == -1);
         u33.IndexOf<1>() = -2;
-        assert(u33.IndexOf<1>() == -2);
+        AKR_CHECK(u33.IndexOf<1>() == -2);
         u33.IndexOf<2>() = -3;
-        assert(u33.IndexOf<2>() == -3);
+        AKR_CHECK(u33.IndexOf<2>() == -3);
         u33.IndexBy(0, [](auto&& e) { e = 1; });
-        assert(u33.IndexOf<0>() == 1);
+        AKR_CHECK(u33.IndexOf<0>() == 1);
         u33.IndexBy(1, [](auto&& e) { e = 2; });
-        assert(u33.IndexOf<1>() == 2);
+        AKR_CHECK(u33.IndexOf<1>() == 2);
         u33.IndexBy(2, [](auto&& e) { e = 3; });
-        assert(u33.IndexOf<2>() == 3);
+        AKR_CHECK(u33.IndexOf<2>() == 3);
         u33.ForEach([](auto&& e) { e = 0; });
-        assert(u33.IndexOf<0>() == 0);
-        assert(u33.IndexOf<1>() == 0);
-        assert(u33.IndexOf<2>() == 0);
+        AKR_CHECK(u33.IndexOf<0>() == 0);
+        AKR_CHECK(u33.IndexOf<1>() == 0);
+        AKR_CHECK(u33.IndexOf<2>() == 0);
 
         u33 = u3;
         static_assert(u33.Count == 3);
         static_assert(std::is_same_v<Tuple<int, int, int>, decltype(u33)>);
         static_assert(std::is_same_v<int&, decltype(u33.IndexOf<0>())>);
-        assert(u33.IndexOf<0>() == 1);
+        AKR_CHECK(u33.IndexOf<0>() == 1);
         static_assert(std::is_same_v<int&, decltype(u33.IndexOf<1>())>);
-        assert(u33.IndexOf<1>() == 2);
+        AKR_CHECK(u33.IndexOf<1>() == 2);
         static_assert(std::is_same_v<int&, decltype(u33.IndexOf<2>())>);
-        assert(u33.IndexOf<2>() == 3);
+        AKR_CHECK(u33.IndexOf<2>() == 3);
 
         using U33 = decltype(Tuple(1ll, 2ll, 3ll));
 
@@ -1054,48 +1708,48 @@ namespace akr::test
         static_assert(u333.Count == 3);
         static_assert(std::is_same_v<Tuple<long long, long long, long long>, decltype(u333)>);
         static_assert(std::is_same_v<long long&, decltype(u333.IndexOf<0>())>);
-        assert(u333.IndexOf<0>() == 1);
+        AKR_CHECK(u333.IndexOf<0>() == 1);
         static_assert(std::is_same_v<long long&, decltype(u333.IndexOf<1>())>);
-        assert(u333.IndexOf<1>() == 2);
+        AKR_CHECK(u333.IndexOf<1>() == 2);
         static_assert(std::is_same_v<long long&, decltype(u333.IndexOf<2>())>);
-        assert(u333.IndexOf<2>() == 3);
+        AKR_CHECK(u333.IndexOf<2>() == 3);
 
         auto u3333 = U33(u3);
         static_assert(u3333.Count == 3);
         static_assert(std::is_same_v<Tuple<long long, long long, long long>, decltype(u3333)>);
         static_assert(std::is_same_v<long long&, decltype(u3333.IndexOf<0>())>);
-        assert(u3333.IndexOf<0>() == 1);
+        AKR_CHECK(u3333.IndexOf<0>() == 1);
         static_assert(std::is_same_v<long long&, decltype(u3333.IndexOf<1>())>);
-        assert(u3333.IndexOf<1>() == 2);
+        AKR_CHECK(u3333.IndexOf<1>() == 2);
         static_assert(std::is_same_v<long long&, decltype(u3333.IndexOf<2>())>);
-        assert(u3333.IndexOf<2>() == 3);
+        AKR_CHECK(u3333.IndexOf<2>() == 3);
 
         u3333.IndexOf<0>() = -1;
-        assert(u3333.IndexOf<0>() == -1);
+        AKR_CHECK(u3333.IndexOf<0>() == -1);
         u3333.IndexOf<1>() = -2;
-        assert(u3333.IndexOf<1>() == -2);
+        AKR_CHECK(u3333.IndexOf<1>() == -2);
         u3333.IndexOf<2>() = -3;
-        assert(u3333.IndexOf<2>() == -3);
+        AKR_CHECK(u3333.IndexOf<2>() == -3);
         u3333.IndexBy(0, [](auto&& e) { e = 1; });
-        assert(u3333.IndexOf<0>() == 1);
+        AKR_CHECK(u3333.IndexOf<0>() == 1);
         u3333.IndexBy(1, [](auto&& e) { e = 2; });
-        assert(u3333.IndexOf<1>() == 2);
+        AKR_CHECK(u3333.IndexOf<1>() == 2);
         u3333.IndexBy(2, [](auto&& e) { e = 3; });
-        assert(u3333.IndexOf<2>() == 3);
+        AKR_CHECK(u3333.IndexOf<2>() == 3);
         u3333.ForEach([](auto&& e) { e = 0; });
-        assert(u3333.IndexOf<0>() == 0);
-        assert(u3333.IndexOf<1>() == 0);
-        assert(u3333.IndexOf<2>() == 0);
+        AKR_CHECK(u3333.IndexOf<0>() == 0);
+        AKR_CHECK(u3333.IndexOf<1>() == 0);
+        AKR_CHECK(u3333.IndexOf<2>() == 0);
 
         u3333 = u3;
         static_assert(u3333.Count == 3);
         static_assert(std::is_same_v<Tuple<long long, long long, long long>, decltype(u3333)>);
         static_assert(std::is_same_v<long long&, decltype(u3333.IndexOf<0>())>);
-        assert(u3333.IndexOf<0>() == 1);
+        AKR_CHECK(u3333.IndexOf<0>() == 1);
         static_assert(std::is_same_v<long long&, decltype(u3333.IndexOf<1>())>);
-        assert(u3333.IndexOf<1>() == 2);
+        AKR_CHECK(u3333.IndexOf<1>() == 2);
         static_assert(std::is_same_v<long long&, decltype(u3333.IndexOf<2>())>);
-        assert(u3333.IndexOf<2>() == 3);
+        AKR_CHECK(u3333.IndexOf<2>() == 3);
 
         using U4 = decltype(Tuple(true, 'A', 123, 3.14, "ABC", nullptr));
 
@@ -1103,62 +1757,62 @@ namespace akr::test
         static_assert(u4.Count == 6);
         static_assert(std::is_same_v<U4, decltype(u4)>);
         static_assert(std::is_same_v<bool&, decltype(u4.IndexOf<0>())>);
-        assert(u4.IndexOf<0>() == true);
+        AKR_CHECK(u4.IndexOf<0>() == true);
         static_assert(std::is_same_v<char&, decltype(u4.IndexOf<1>())>);
-        assert(u4.IndexOf<1>() == 'A');
+        AKR_CHECK(u4.IndexOf<1>() == 'A');
         static_assert(std::is_same_v<int&, decltype(u4.IndexOf<2>())>);
-        assert(u4.IndexOf<2>() == 123);
+        AKR_CHECK(u4.IndexOf<2>() == 123);
         static_assert(std::is_same_v<double&, decltype(u4.IndexOf<3>())>);
-        assert(u4.IndexOf<3>() == 3.14);
+        AKR_CHECK(u4.IndexOf<3>() == 3.14);
         static_assert(std::is_same_v<const char*&, decltype(u4.IndexOf<4>())>);
-        assert(!std::strcmp(u4.IndexOf<4>(), "ABC"));
+        AKR_CHECK(!std::strcmp(u4.IndexOf<4>(), "ABC"));
         static_assert(std::is_same_v<std::nullptr_t&, decltype(u4.IndexOf<5>())>);
-        assert(u4.IndexOf<5>() == nullptr);
+        AKR_CHECK(u4.IndexOf<5>() == nullptr);
 
         auto u44 = u4;
         static_assert(u44.Count == 6);
         static_assert(std::is_same_v<U4, decltype(u44)>);
         static_assert(std::is_same_v<bool&, decltype(u44.IndexOf<0>())>);
-        assert(u44.IndexOf<0>() == true);
+        AKR_CHECK(u44.IndexOf<0>() == true);
         static_assert(std::is_same_v<char&, decltype(u44.IndexOf<1>())>);
-        assert(u44.IndexOf<1>() == 'A');
+        AKR_CHECK(u44.IndexOf<1>() == 'A');
         static_assert(std::is_same_v<int&, decltype(u44.IndexOf<2>())>);
-        assert(u44.IndexOf<2>() == 123);
+        AKR_CHECK(u44.IndexOf<2>() == 123);
         static_assert(std::is_same_v<double&, decltype(u44.IndexOf<3>())>);
-        assert(u44.IndexOf<3>() == 3.14);
+        AKR_CHECK(u44.IndexOf<3>() == 3.14);
         static_assert(std::is_same_v<const char*&, decltype(u44.IndexOf<4>())>);
-        assert(!std::strcmp(u44.IndexOf<4>(), "ABC"));
+        AKR_CHECK(!std::strcmp(u44.IndexOf<4>(), "ABC"));
         static_assert(std::is_same_v<std::nullptr_t&, decltype(u44.IndexOf<5>())>);
-        assert(u44.IndexOf<5>() == nullptr);
+        AKR_CHECK(u44.IndexOf<5>() == nullptr);
 
         u44.IndexOf<0>() = false;
-        assert(u44.IndexOf<0>() == false);
+        AKR_CHECK(u44.IndexOf<0>() == false);
         u44.IndexOf<1>() = 'a';
-        assert(u44.IndexOf<1>() == 'a');
+        AKR_CHECK(u44.IndexOf<1>() == 'a');
         u44.IndexOf<2>() = -123;
-        assert(u44.IndexOf<2>() == -123);
+        AKR_CHECK(u44.IndexOf<2>() == -123);
         u44.IndexOf<3>() = -3.14;
-        assert(u44.IndexOf<3>() == -3.14);
+        AKR_CHECK(u44.IndexOf<3>() == -3.14);
         u44.IndexOf<4>() = "abc";
-        assert(!std::strcmp(u44.IndexOf<4>(), "abc"));
+        AKR_CHECK(!std::strcmp(u44.IndexOf<4>(), "abc"));
         u44.IndexOf<5>() = nullptr;
-        assert(u44.IndexOf<5>() == nullptr);
+        AKR_CHECK(u44.IndexOf<5>() == nullptr);
 
         u44 = u4;
         static_assert(u44.Count == 6);
         static_assert(std::is_same_v<U4, decltype(u44)>);
         static_assert(std::is_same_v<bool&, decltype(u44.IndexOf<0>())>);
-        assert(u44.IndexOf<0>() == true);
+        AKR_CHECK(u44.IndexOf<0>() == true);
         static_assert(std::is_same_v<char&, decltype(u44.IndexOf<1>())>);
-        assert(u44.IndexOf<1>() == 'A');
+        AKR_CHECK(u44.IndexOf<1>() == 'A');
         static_assert(std::is_same_v<int&, decltype(u44.IndexOf<2>())>);
-        assert(u44.IndexOf<2>() == 123);
+        AKR_CHECK(u44.IndexOf<2>() == 123);
         static_assert(std::is_same_v<double&, decltype(u44.IndexOf<3>())>);
-        assert(u44.IndexOf<3>() == 3.14);
+        AKR_CHECK(u44.IndexOf<3>() == 3.14);
         static_assert(std::is_same_v<const char*&, decltype(u44.IndexOf<4>())>);
-        assert(!std::strcmp(u44.IndexOf<4>(), "ABC"));
+        AKR_CHECK(!std::strcmp(u44.IndexOf<4>(), "ABC"));
         static_assert(std::is_same_v<std::nullptr_t&, decltype(u44.IndexOf<5>())>);
-        assert(u44.IndexOf<5>() == nullptr);
+        AKR_CHECK(u44.IndexOf<5>() == nullptr);
 
         using U44 = decltype(Tuple(1, 2, 3ll, 3.14, std::string(), nullptr));
 
@@ -1166,151 +1820,479 @@ namespace akr::test
         static_assert(u444.Count == 6);
         static_assert(std::is_same_v<U44, decltype(u444)>);
         static_assert(std::is_same_v<int&, decltype(u444.IndexOf<0>())>);
-        assert(u444.IndexOf<0>() == true);
+        AKR_CHECK(u444.IndexOf<0>() == true);
         static_assert(std::is_same_v<int&, decltype(u444.IndexOf<1>())>);
-        assert(u444.IndexOf<1>() == 'A');
+        AKR_CHECK(u444.IndexOf<1>() == 'A');
         static_assert(std::is_same_v<long long&, decltype(u444.IndexOf<2>())>);
-        assert(u444.IndexOf<2>() == 123);
+        AKR_CHECK(u444.IndexOf<2>() == 123);
         static_assert(std::is_same_v<double&, decltype(u444.IndexOf<3>())>);
-        assert(u444.IndexOf<3>() == 3.14);
+        AKR_CHECK(u444.IndexOf<3>() == 3.14);
         static_assert(std::is_same_v<std::string&, decltype(u444.IndexOf<4>())>);
-        assert(u444.IndexOf<4>() == "ABC");
+        AKR_CHECK(u444.IndexOf<4>() == "ABC");
         static_assert(std::is_same_v<std::nullptr_t&, decltype(u444.IndexOf<5>())>);
-        assert(u444.IndexOf<5>() == nullptr);
+        AKR_CHECK(u444.IndexOf<5>() == nullptr);
 
         auto u4444 = U44(u4);
         static_assert(u4444.Count == 6);
         static_assert(std::is_same_v<U44, decltype(u4444)>);
         static_assert(std::is_same_v<int&, decltype(u4444.IndexOf<0>())>);
-        assert(u4444.IndexOf<0>() == true);
+        AKR_CHECK(u4444.IndexOf<0>() == true);
         static_assert(std::is_same_v<int&, decltype(u4444.IndexOf<1>())>);
-        assert(u4444.IndexOf<1>() == 'A');
+        AKR_CHECK(u4444.IndexOf<1>() == 'A');
         static_assert(std::is_same_v<long long&, decltype(u4444.IndexOf<2>())>);
-        assert(u4444.IndexOf<2>() == 123);
+        AKR_CHECK(u4444.IndexOf<2>() == 123);
         static_assert(std::is_same_v<double&, decltype(u4444.IndexOf<3>())>);
-        assert(u4444.IndexOf<3>() == 3.14);
+        AKR_CHECK(u4444.IndexOf<3>() == 3.14);
         static_assert(std::is_same_v<std::string&, decltype(u4444.IndexOf<4>())>);
-        assert(u4444.IndexOf<4>() == "ABC");
+        AKR_CHECK(u4444.IndexOf<4>() == "ABC");
         static_assert(std::is_same_v<std::nullptr_t&, decltype(u4444.IndexOf<5>())>);
-        assert(u4444.IndexOf<5>() == nullptr);
+        AKR_CHECK(u4444.IndexOf<5>() == nullptr);
 
         u4444.IndexOf<0>() = false;
-        assert(u4444.IndexOf<0>() == false);
+        AKR_CHECK(u4444.IndexOf<0>() == false);
         u4444.IndexOf<1>() = 'a';
-        assert(u4444.IndexOf<1>() == 'a');
+        AKR_CHECK(u4444.IndexOf<1>() == 'a');
         u4444.IndexOf<2>() = -123;
-        assert(u4444.IndexOf<2>() == -123);
+        AKR_CHECK(u4444.IndexOf<2>() == -123);
         u4444.IndexOf<3>() = -3.14;
-        assert(u4444.IndexOf<3>() == -3.14);
+        AKR_CHECK(u4444.IndexOf<3>() == -3.14);
         u4444.IndexOf<4>() = "abc";
-        assert(u4444.IndexOf<4>() =="abc");
+        AKR_CHECK(u4444.IndexOf<4>() =="abc");
         u4444.IndexOf<5>() = nullptr;
-        assert(u4444.IndexOf<5>() == nullptr);
+        AKR_CHECK(u4444.IndexOf<5>() == nullptr);
 
         u4444 = u4;
         static_assert(u4444.Count == 6);
         static_assert(std::is_same_v<U44, decltype(u4444)>);
         static_assert(std::is_same_v<int&, decltype(u4444.IndexOf<0>())>);
-        assert(u4444.IndexOf<0>() == true);
+        AKR_CHECK(u4444.IndexOf<0>() == true);
         static_assert(std::is_same_v<int&, decltype(u4444.IndexOf<1>())>);
-        assert(u4444.IndexOf<1>() == 'A');
+        AKR_CHECK(u4444.IndexOf<1>() == 'A');
         static_assert(std::is_same_v<long long&, decltype(u4444.IndexOf<2>())>);
-        assert(u4444.IndexOf<2>() == 123);
+        AKR_CHECK(u4444.IndexOf<2>() == 123);
         static_assert(std::is_same_v<double&, decltype(u4444.IndexOf<3>())>);
-        assert(u4444.IndexOf<3>() == 3.14);
+        AKR_CHECK(u4444.IndexOf<3>() == 3.14);
         static_assert(std::is_same_v<std::string&, decltype(u4444.IndexOf<4>())>);
-        assert(u4444.IndexOf<4>() == "ABC");
+        AKR_CHECK(u4444.IndexOf<4>() == "ABC");
         static_assert(std::is_same_v<std::nullptr_t&, decltype(u4444.IndexOf<5>())>);
-        assert(u4444.IndexOf<5>() == nullptr);
+        AKR_CHECK(u4444.IndexOf<5>() == nullptr);
 
         auto s1 = std::string("1");
         auto r1 = Tuple<      std::string& >(          s1 );
-        assert(r1.IndexOf<0>() == "1");
+        AKR_CHECK(r1.IndexOf<0>() == "1");
         r1.IndexOf<0>() = "-1";
-        assert(r1.IndexOf<0>() == "-1");
-        assert(s1 == "-1");
+        AKR_CHECK(r1.IndexOf<0>() == "-1");
+        AKR_CHECK(s1 == "-1");
 
         auto sx = std::string("X");
         auto rx = Tuple<      std::string  >(          sx );
-        assert(rx.IndexOf<0>() == "X");
+        AKR_CHECK(rx.IndexOf<0>() == "X");
         r1 = rx;
-        assert(r1.IndexOf<0>() == "X");
-        assert(s1 == "X");
+        AKR_CHECK(r1.IndexOf<0>() == "X");
+        AKR_CHECK(s1 == "X");
 
         auto s2 = std::string("1");
         auto r2 = Tuple<const std::string& >(          s2 );
-        assert(r2.IndexOf<0>() == "1");
+        AKR_CHECK(r2.IndexOf<0>() == "1");
 
         auto s3 = std::string("1");
         auto r3 = Tuple<      std::string&&>(std::move(s3));
-        assert(r3.IndexOf<0>() == "1");
+        AKR_CHECK(r3.IndexOf<0>() == "1");
         r3.IndexOf<0>() = "-1";
-        assert(r3.IndexOf<0>() == "-1");
-        assert(s3 == "-1");
+        AKR_CHECK(r3.IndexOf<0>() == "-1");
+        AKR_CHECK(s3 == "-1");
 
         auto ta = Tuple() & true & 'A' & 123 & 3.14 & "ABC" & nullptr;
         static_assert(ta.Count == 6);
         static_assert(std::is_same_v<T4, decltype(ta)>);
         static_assert(std::is_same_v<bool&, decltype(ta.IndexOf<0>())>);
-        assert(ta.IndexOf<0>() == true);
+        AKR_CHECK(ta.IndexOf<0>() == true);
         static_assert(std::is_same_v<char&, decltype(ta.IndexOf<1>())>);
-        assert(ta.IndexOf<1>() == 'A');
+        AKR_CHECK(ta.IndexOf<1>() == 'A');
         static_assert(std::is_same_v<int&, decltype(ta.IndexOf<2>())>);
-        assert(ta.IndexOf<2>() == 123);
+        AKR_CHECK(ta.IndexOf<2>() == 123);
         static_assert(std::is_same_v<double&, decltype(ta.IndexOf<3>())>);
-        assert(ta.IndexOf<3>() == 3.14);
+        AKR_CHECK(ta.IndexOf<3>() == 3.14);
         static_assert(std::is_same_v<const char*&, decltype(ta.IndexOf<4>())>);
-        assert(!std::strcmp(ta.IndexOf<4>(), "ABC"));
+        AKR_CHECK(!std::strcmp(ta.IndexOf<4>(), "ABC"));
         static_assert(std::is_same_v<std::nullptr_t&, decltype(ta.IndexOf<5>())>);
-        assert(ta.IndexOf<5>() == nullptr);
+        AKR_CHECK(ta.IndexOf<5>() == nullptr);
 
         auto tb = Tuple() + Tuple(true) + Tuple('A') + Tuple(123) + Tuple(3.14) + Tuple("ABC") + Tuple(nullptr);
         static_assert(tb.Count == 6);
         static_assert(std::is_same_v<T4, decltype(tb)>);
         static_assert(std::is_same_v<bool&, decltype(tb.IndexOf<0>())>);
-        assert(tb.IndexOf<0>() == true);
+        AKR_CHECK(tb.IndexOf<0>() == true);
         static_assert(std::is_same_v<char&, decltype(tb.IndexOf<1>())>);
-        assert(tb.IndexOf<1>() == 'A');
+        AKR_CHECK(tb.IndexOf<1>() == 'A');
         static_assert(std::is_same_v<int&, decltype(tb.IndexOf<2>())>);
-        assert(tb.IndexOf<2>() == 123);
+        AKR_CHECK(tb.IndexOf<2>() == 123);
         static_assert(std::is_same_v<double&, decltype(tb.IndexOf<3>())>);
-        assert(tb.IndexOf<3>() == 3.14);
+        AKR_CHECK(tb.IndexOf<3>() == 3.14);
         static_assert(std::is_same_v<const char*&, decltype(tb.IndexOf<4>())>);
-        assert(!std::strcmp(tb.IndexOf<4>(), "ABC"));
+        AKR_CHECK(!std::strcmp(tb.IndexOf<4>(), "ABC"));
         static_assert(std::is_same_v<std::nullptr_t&, decltype(tb.IndexOf<5>())>);
-        assert(tb.IndexOf<5>() == nullptr);
+        AKR_CHECK(tb.IndexOf<5>() == nullptr);
 
         auto tc = Tuple<>::Concat(Tuple(), true, 'A', 123, 3.14, "ABC", nullptr);
         static_assert(tc.Count == 6);
         static_assert(std::is_same_v<T4, decltype(tc)>);
         static_assert(std::is_same_v<bool&, decltype(tc.IndexOf<0>())>);
-        assert(tc.IndexOf<0>() == true);
+        AKR_CHECK(tc.IndexOf<0>() == true);
         static_assert(std::is_same_v<char&, decltype(tc.IndexOf<1>())>);
-        assert(tc.IndexOf<1>() == 'A');
+        AKR_CHECK(tc.IndexOf<1>() == 'A');
         static_assert(std::is_same_v<int&, decltype(tc.IndexOf<2>())>);
-        assert(tc.IndexOf<2>() == 123);
+        AKR_CHECK(tc.IndexOf<2>() == 123);
         static_assert(std::is_same_v<double&, decltype(tc.IndexOf<3>())>);
-        assert(tc.IndexOf<3>() == 3.14);
+        AKR_CHECK(tc.IndexOf<3>() == 3.14);
         static_assert(std::is_same_v<const char*&, decltype(tc.IndexOf<4>())>);
-        assert(!std::strcmp(tc.IndexOf<4>(), "ABC"));
+        AKR_CHECK(!std::strcmp(tc.IndexOf<4>(), "ABC"));
         static_assert(std::is_same_v<std::nullptr_t&, decltype(tc.IndexOf<5>())>);
-        assert(tc.IndexOf<5>() == nullptr);
+        AKR_CHECK(tc.IndexOf<5>() == nullptr);
 
         auto td = Tuple<>::Concat(Tuple(), Tuple(true, 'A', 123), Tuple(3.14, "ABC", nullptr));
         static_assert(td.Count == 6);
         static_assert(std::is_same_v<T4, decltype(td)>);
         static_assert(std::is_same_v<bool&, decltype(td.IndexOf<0>())>);
-        assert(td.IndexOf<0>() == true);
+        AKR_CHECK(td.IndexOf<0>() == true);
         static_assert(std::is_same_v<char&, decltype(td.IndexOf<1>())>);
-        assert(td.IndexOf<1>() == 'A');
+        AKR_CHECK(td.IndexOf<1>() == 'A');
         static_assert(std::is_same_v<int&, decltype(td.IndexOf<2>())>);
-        assert(td.IndexOf<2>() == 123);
+        AKR_CHECK(td.IndexOf<2>() == 123);
         static_assert(std::is_same_v<double&, decltype(td.IndexOf<3>())>);
-        assert(td.IndexOf<3>() == 3.14);
+        AKR_CHECK(td.IndexOf<3>() == 3.14);
         static_assert(std::is_same_v<const char*&, decltype(td.IndexOf<4>())>);
-        assert(!std::strcmp(td.IndexOf<4>(), "ABC"));
+        AKR_CHECK(!std::strcmp(td.IndexOf<4>(), "ABC"));
         static_assert(std::is_same_v<std::nullptr_t&, decltype(td.IndexOf<5>())>);
-        assert(td.IndexOf<5>() == nullptr);
+        AKR_CHECK(td.IndexOf<5>() == nullptr);
+    });
+
+    AKR_TEST(HomogeneousTuple,
+    {
+        using H4 = decltype(Tuple(1.0, 2.0, 3.0, 4.0));
+        static_assert(sizeof(H4) == sizeof(double[4]));
+        static_assert(TupleHelper<H4>::IsHomogeneous);
+        static_assert(!TupleHelper<decltype(Tuple(1.0))>::IsHomogeneous);
+        static_assert(!TupleHelper<decltype(Tuple(1.0, 2))>::IsHomogeneous);
+        static_assert(std::is_same_v<std::span<double, 4>, decltype(std::declval<H4&>().Span())>);
+        static_assert(std::is_same_v<std::span<const double, 4>, decltype(std::declval<const H4&>().Span())>);
+
+        static_assert(noexcept(H4(std::declval<H4>())));
+        static_assert(noexcept(std::declval<H4>().ForEach(std::declval<decltype([](auto&&) noexcept(true ) {})>())));
+        static_assert(!noexcept(std::declval<H4>().ForEach(std::declval<decltype([](auto&&) noexcept(false) {})>())));
+
+        static_assert(Tuple(1, 2, 3).IndexOf<2>() == 3);
+        static_assert(Tuple(1, 2, 3).Span()[1] == 2);
+
+        auto h4 = H4(1.0, 2.0, 3.0, 4.0);
+        AKR_CHECK(h4.IndexOf<0>() == 1.0);
+        AKR_CHECK(h4.IndexOf<3>() == 4.0);
+        AKR_CHECK(h4.Span().data() == &h4.IndexOf<0>());
+
+        auto sum = 0.0;
+        h4.ForEach([&](auto&& e) { sum += e; });
+        AKR_CHECK(sum == 10.0);
+        h4.ForEach([](auto&& e) { e *= 2; });
+        AKR_CHECK(h4.IndexOf<1>() == 4.0);
+
+        h4.IndexBy(2, [](auto&& e) { e = -1; });
+        AKR_CHECK(h4.IndexOf<2>() == -1.0);
+
+        auto thrown = false;
+        try
+        {
+            h4.IndexBy(4, [](auto&&) {});
+        }
+        catch (const std::out_of_range&)
+        {
+            thrown = true;
+        }
+        AKR_CHECK(thrown);
+
+        auto h44 = H4(Tuple(1.0f, 2.0, 3.0f, 4.0));
+        AKR_CHECK(h44.IndexOf<0>() == 1.0);
+        AKR_CHECK(h44.IndexOf<3>() == 4.0);
+
+        using T4 = decltype(Tuple(1.0l, 2.0, 3.0l, 4.0));
+
+        auto t4 = T4(h44);
+        AKR_CHECK(t4.IndexOf<0>() == 1.0l);
+        AKR_CHECK(t4.IndexOf<3>() == 4.0);
+
+        h44 = Tuple(5.0f, 6.0, 7.0f, 8.0);
+        AKR_CHECK(h44.IndexOf<0>() == 5.0);
+        AKR_CHECK(h44.IndexOf<3>() == 8.0);
+
+        auto m = Tuple(std::string("A"), 1, 2);
+        AKR_CHECK(m.IndexOf<0>() == "A");
+        AKR_CHECK(m.IndexOf<2>() == 2);
+        m.IndexBy(1, [](auto&& e) { if constexpr (std::is_same_v<int&, decltype(e)>) { e = 3; } });
+        AKR_CHECK(m.IndexOf<1>() == 3);
+
+        auto m2 = decltype(m)(std::move(m));
+        AKR_CHECK(m2.IndexOf<0>() == "A");
+
+        auto c = Tuple(1, 2) + Tuple(3, 4);
+        static_assert(std::is_same_v<decltype(Tuple(1, 2, 3, 4)), decltype(c)>);
+        AKR_CHECK(c.IndexOf<3>() == 4);
+
+        auto s = Tuple(std::string("A"), std::string("B"));
+        auto s2 = decltype(s)(std::move(s));
+        AKR_CHECK(s2.IndexOf<1>() == "B");
+        s = s2;
+        AKR_CHECK(s.IndexOf<0>() == "A");
+    });
+
+    AKR_TEST(Emplace,
+    {
+        static auto constructions = 0;
+
+        struct Pinned
+        {
+            int  id;
+            char buffer[256];
+
+            Pinned(int id_, char fill): id { id_ } { ++constructions; std::memset(buffer, fill, sizeof(buffer)); }
+
+            Pinned(const Pinned&) = delete;
+
+            auto operator=(const Pinned&) -> Pinned& = delete;
+        };
+
+        struct Checked
+        {
+            int id = -1;
+
+            Checked() noexcept = default;
+
+            explicit Checked(int id_): id { id_ } { if (id_ < 0) throw std::invalid_argument("negative id."); }
+
+            Checked(const Checked&) = delete;
+        };
+
+        using T1 = Tuple<Pinned, std::string, Pinned>;
+        using T2 = Tuple<Pinned, Pinned>;
+
+        static_assert(!std::is_move_constructible_v<Pinned> && !std::is_move_assignable_v<Pinned>);
+        static_assert( std::is_nothrow_constructible_v<Tuple<int, int>, std::piecewise_construct_t, std::tuple<int>, std::tuple<>>);
+        static_assert(!std::is_nothrow_constructible_v<T2, std::piecewise_construct_t, std::tuple<int, char>, std::tuple<int, char>>);
+        static_assert( noexcept(std::declval<T1&>().Emplace<0>(1, 'A')));
+        static_assert(!noexcept(std::declval<Tuple<Checked>&>().Emplace<0>(1)));
+
+        auto t1 = T1(std::piecewise_construct,
+            std::forward_as_tuple(1, 'A'), std::forward_as_tuple(3, 'B'), std::forward_as_tuple(2, 'C'));
+        AKR_CHECK(constructions == 2);
+        AKR_CHECK(t1.IndexOf<0>().id == 1);
+        AKR_CHECK(t1.IndexOf<0>().buffer[255] == 'A');
+        AKR_CHECK(t1.IndexOf<1>() == "BBB");
+        AKR_CHECK(t1.IndexOf<2>().buffer[0] == 'C');
+
+        auto&& e1 = t1.Emplace<2>(4, 'D');
+        AKR_CHECK(constructions == 3);
+        AKR_CHECK(&e1 == &t1.IndexOf<2>());
+        AKR_CHECK(t1.IndexOf<2>().id == 4);
+        AKR_CHECK(t1.IndexOf<2>().buffer[128] == 'D');
+
+        t1.Emplace<1>(2, 'E');
+        AKR_CHECK(t1.IndexOf<1>() == "EE");
+
+        auto t2 = T2(std::piecewise_construct, std::forward_as_tuple(1, 'A'), std::forward_as_tuple(2, 'B'));
+        AKR_CHECK(constructions == 5);
+        AKR_CHECK(t2.IndexOf<1>().id == 2);
+        t2.Emplace<0>(5, 'F');
+        AKR_CHECK(constructions == 6);
+        AKR_CHECK(t2.IndexOf<0>().id == 5);
+        AKR_CHECK(t2.IndexOf<0>().buffer[1] == 'F');
+
+        auto t3 = Tuple<Checked, int>(std::piecewise_construct, std::forward_as_tuple(1), std::forward_as_tuple(2));
+        t3.Emplace<0>(3);
+        AKR_CHECK(t3.IndexOf<0>().id == 3);
+
+        auto thrown = false;
+        try
+        {
+            t3.Emplace<0>(-1);
+        }
+        catch (const std::invalid_argument&)
+        {
+            thrown = true;
+        }
+        AKR_CHECK(thrown);
+        AKR_CHECK(t3.IndexOf<0>().id == -1);
+
+        static_assert(Tuple<int, int>(std::piecewise_construct, std::tuple(1), std::tuple()).IndexOf<0>() == 1);
+        static_assert([]() { auto t = Tuple(1, 'A'); t.Emplace<1>('B'); return t.IndexOf<1>(); }() == 'B');
+    });
+
+    AKR_TEST(Zip,
+    {
+        using F4 = decltype(Tuple(1.0f, 2.0f, 3.0f, 4.0f));
+
+        static_assert(Tuple<>::Add(Tuple(1, 2), Tuple(3, 4)).IndexOf<1>() == 6);
+        static_assert(Tuple<>::Map(Tuple(1, 'A'), [](auto e) { return e + 1; }).IndexOf<1>() == 'B');
+
+        auto f1 = F4(1.0f, 2.0f, 3.0f, 4.0f);
+        auto f2 = F4(4.0f, 3.0f, 2.0f, 1.0f);
+
+        auto fa = Tuple<>::Add(f1, f2);
+        static_assert(std::is_same_v<F4, decltype(fa)>);
+        fa.ForEach([](auto&& e) { AKR_CHECK(e == 5.0f); });
+
+        auto fs = Tuple<>::Subtract(f1, f2);
+        AKR_CHECK(fs.IndexOf<0>() == -3.0f);
+        AKR_CHECK(fs.IndexOf<3>() ==  3.0f);
+
+        auto fm = Tuple<>::Multiply(f1, f2);
+        AKR_CHECK(fm.IndexOf<1>() == 6.0f);
+
+        auto fd = Tuple<>::Divide(f1, f2);
+        AKR_CHECK(fd.IndexOf<3>() == 4.0f);
+
+        using I4 = Tuple<std::int8_t, std::int8_t>;
+
+        auto i1 = Tuple<>::Add(I4(std::int8_t(100), std::int8_t(1)), I4(std::int8_t(27), std::int8_t(1)));
+        static_assert(std::is_same_v<I4, decltype(i1)>);
+        AKR_CHECK(i1.IndexOf<0>() == 127);
+
+        auto m1 = Tuple<>::Zip(Tuple(1, 2.5, std::string("A")), Tuple(2, 0.5, std::string("B")),
+                               [](const auto& lhs, const auto& rhs) { return lhs + rhs; });
+        static_assert(std::is_same_v<decltype(Tuple(1, 2.5, std::string())), decltype(m1)>);
+        AKR_CHECK(m1.IndexOf<0>() == 3);
+        AKR_CHECK(m1.IndexOf<1>() == 3.0);
+        AKR_CHECK(m1.IndexOf<2>() == "AB");
+
+        auto m2 = Tuple<>::Add(Tuple(1, 2.5), Tuple(2.5, 1));
+        static_assert(std::is_same_v<decltype(Tuple(1.0, 2.5)), decltype(m2)>);
+        AKR_CHECK(m2.IndexOf<0>() == 3.5);
+
+        auto m3 = Tuple<>::Map(f1, [](float e) { return e * 2; });
+        static_assert(std::is_same_v<F4, decltype(m3)>);
+        AKR_CHECK(m3.IndexOf<3>() == 8.0f);
+
+        auto m4 = Tuple<>::Map(f1, [](float e) { return static_cast<int>(e); });
+        static_assert(std::is_same_v<decltype(Tuple(1, 2, 3, 4)), decltype(m4)>);
+        AKR_CHECK(m4.IndexOf<2>() == 3);
+
+        auto m5 = Tuple<>::Map(Tuple(), [](auto e) { return e; });
+        static_assert(std::is_same_v<Tuple<>, decltype(m5)>);
+    });
+#ifdef  D_AKR_TUPLE_TRACE
+    AKR_TEST(TupleTrace,
+    {
+        using K = TupleTrace::Kind;
+
+        auto s = std::string("ABC");
+
+        TupleTrace::Reset();
+        auto t1 = Tuple(s, 1);
+        AKR_CHECK(TupleTrace::Of(K::Construct).copies == 1);
+        AKR_CHECK(TupleTrace::Of(K::Construct).moves  == 1);
+
+        TupleTrace::Reset();
+        auto t2 = Tuple(std::move(s), 2);
+        auto t3 = std::move(t2) + Tuple(3.0);
+        AKR_CHECK(TupleTrace::Of(K::Construct).moves  == 3);
+        AKR_CHECK(TupleTrace::Of(K::Combine  ).copies == 0);
+        AKR_CHECK(TupleTrace::Of(K::Combine  ).moves  == 3);
+
+        TupleTrace::Reset();
+        auto t4 = t3 & 'A';
+        AKR_CHECK(TupleTrace::Of(K::Append).copies == 3);
+        AKR_CHECK(TupleTrace::Of(K::Append).moves  == 2);
+        AKR_CHECK(TupleTrace::Of(K::Combine).copies == 0);
+
+        TupleTrace::Reset();
+        auto t5 = decltype(Tuple(std::string(), 0L))(t1);
+        AKR_CHECK(TupleTrace::Of(K::Convert).copies        == 1);
+        AKR_CHECK(TupleTrace::Of(K::Convert).constructions == 1);
+
+        TupleTrace::Reset();
+        t5 = std::move(t1);
+        AKR_CHECK(TupleTrace::Of(K::Assign).moves         == 1);
+        AKR_CHECK(TupleTrace::Of(K::Assign).constructions == 1);
+
+        TupleTrace::Reset();
+        auto t6 = Tuple<>::Concat(std::string("X"), 1, Tuple(2, 3));
+        AKR_CHECK(TupleTrace::Of(K::Concat ).copies == 0);
+        AKR_CHECK(TupleTrace::Of(K::Combine).moves  == 0);
+        AKR_CHECK(TupleTrace::Total().copies == 0);
+
+        TupleTrace::Reset();
+        constexpr auto t7 = Tuple(1, 2, 3);
+        static_assert(t7.IndexOf<2>() == 3);
+        auto t8 = Tuple(1, 2, 3);
+        AKR_CHECK(TupleTrace::Total().moves == 3);
+        AKR_CHECK(t4.IndexOf<3>() == 'A' && t6.IndexOf<0>() == "X" && t8.IndexOf<0>() == 1);
+
+        TupleTrace::Reset();
+        auto t9 = Tuple<std::string, std::string, int>(std::piecewise_construct,
+                                                       std::forward_as_tuple(t5.IndexOf<0>()),
+                                                       std::forward_as_tuple(3, 'B'),
+                                                       std::tuple());
+        AKR_CHECK(TupleTrace::Of(K::Construct).copies        == 1);
+        AKR_CHECK(TupleTrace::Of(K::Construct).constructions == 2);
+
+        TupleTrace::Reset();
+        t9.Emplace<0>(std::move(t9.IndexOf<1>()));
+        t9.Emplace<1>(2, 'C');
+        t9.Emplace<2>();
+        auto t10 = Tuple<std::string, std::string>(std::piecewise_construct, std::tuple("D"), std::tuple("E"));
+        t10.Emplace<1>(t9.IndexOf<0>());
+        AKR_CHECK(TupleTrace::Of(K::Emplace).moves         == 1);
+        AKR_CHECK(TupleTrace::Of(K::Emplace).copies        == 1);
+        AKR_CHECK(TupleTrace::Of(K::Emplace).constructions == 2);
+        AKR_CHECK(TupleTrace::Of(K::Construct).constructions == 2);
+        AKR_CHECK(t9.IndexOf<1>() == "CC" && t10.IndexOf<1>() == "BBB");
+    });
+#endif
+    inline constexpr auto ConstantTable = Tuple<>::Sort<0>(std::array
+    {
+        Tuple(std::string_view("delta"), std::uint32_t(4), 4.5),
+        Tuple(std::string_view("alpha"), std::uint32_t(1), 1.5),
+        Tuple(std::string_view("gamma"), std::uint32_t(3), 3.5),
+        Tuple(std::string_view("beta" ), std::uint32_t(2), 2.5),
+    });
+
+    constinit inline auto ConstantConcat = Tuple<>::Concat(Tuple(std::string_view("A"), 1), 2.5, Tuple('B')) & 3u;
+
+    AKR_TEST(Constant,
+    {
+        static_assert(ConstantTable[0].IndexOf<0>() == "alpha");
+        static_assert(ConstantTable[3].IndexOf<0>() == "gamma");
+        static_assert(ConstantTable[1].IndexOf<1>() == 2);
+
+        constexpr auto s1 = (Tuple<>::Sort(std::array { Tuple(2, 'b'), Tuple(1, 'z'), Tuple(2, 'a') }));
+        static_assert(s1[0].IndexOf<1>() == 'z');
+        static_assert(s1[1].IndexOf<1>() == 'a');
+
+        constexpr auto s2 = (Tuple<>::Sort<1, 0>(s1));
+        static_assert(s2[0].IndexOf<1>() == 'a');
+        static_assert(s2[2].IndexOf<0>() == 1);
+
+        constexpr auto s3 = (Tuple<>::Sort(std::array { Tuple(3, 1, 2), Tuple(1, 2, 3) }));
+        static_assert(s3[0].IndexOf<0>() == 1);
+
+        static_assert([]()
+        {
+            auto s4 = Tuple<>::Sort(std::array { Tuple(5), Tuple(3), Tuple(9), Tuple(1), Tuple(3), Tuple(7), Tuple(0), Tuple(8), Tuple(2) });
+            auto result = 0;
+            for (auto&& e : s4)
+            {
+                result = result * 10 + e.IndexOf<0>();
+            }
+            return result;
+        }() == 12335789 && Tuple<>::Sort(std::array<Tuple<int>, 0>()).empty());
+
+        auto s5 = Tuple<>::Sort<1>(std::array { Tuple(1, std::string("kiwi")), Tuple(2, std::string("apple")),
+                                                Tuple(3, std::string("fig" )), Tuple(4, std::string("date" )) });
+        AKR_CHECK(s5[0].IndexOf<0>() == 2 && s5[1].IndexOf<0>() == 4 && s5[2].IndexOf<0>() == 3 && s5[3].IndexOf<0>() == 1);
+
+        static_assert((std::is_same_v<decltype(Tuple(std::string_view(), 1, 2.5, 'B', 3u)), decltype(ConstantConcat)>));
+        AKR_CHECK(ConstantConcat.IndexOf<0>() == "A");
+        AKR_CHECK(ConstantConcat.IndexOf<4>() == 3u);
+
+        ConstantConcat.IndexOf<1>() = 2;
+        AKR_CHECK(ConstantConcat.IndexOf<1>() == 2);
     });
 }
 #endif//D_AKR_TEST
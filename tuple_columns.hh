@@ -0,0 +1,759 @@
+#ifndef Z_AKR_TUPLE_COLUMNS_HH
+#define Z_AKR_TUPLE_COLUMNS_HH
+
+#include "tuple.hh"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace akr
+{
+    struct PackedBlocks final
+    {
+        public:
+        inline static constexpr std::size_t BlockSize = 128;
+
+        private:
+        struct Block final
+        {
+            public:
+            std::uint64_t min;
+
+            std::uint32_t offset;
+
+            std::uint32_t width;
+        };
+
+        std::vector<std::uint64_t> words;
+
+        std::vector<Block> blocks;
+
+        std::vector<std::uint64_t> tail;
+
+        void seal()
+        {
+            auto [min, max] = std::minmax_element(tail.begin(), tail.end());
+
+            auto block = Block { *min, static_cast<std::uint32_t>(words.size()), static_cast<std::uint32_t>(std::bit_width(*max - *min)) };
+
+            words.resize(words.size() + block.width * BlockSize / 64);
+
+            if (block.width != 0)
+            {
+                for (std::size_t i = 0; i != BlockSize; ++i)
+                {
+                    auto value = tail[i] - block.min;
+                    auto bit   = i * block.width;
+                    auto word  = block.offset + bit / 64;
+                    auto shift = bit % 64;
+
+                    words[word] |= value << shift;
+
+                    if (shift + block.width > 64)
+                    {
+                        words[word + 1] |= value >> (64 - shift);
+                    }
+                }
+            }
+
+            blocks.push_back(block);
+
+            tail.clear();
+        }
+
+        public:
+        void Push(std::uint64_t value)
+        {
+            tail.push_back(value);
+
+            if (tail.size() == BlockSize)
+            {
+                seal();
+            }
+        }
+
+        auto Size() const noexcept -> std::size_t
+        {
+            return blocks.size() * BlockSize + tail.size();
+        }
+
+        auto Bytes() const noexcept -> std::size_t
+        {
+            return words.size() * sizeof(std::uint64_t) + blocks.size() * sizeof(Block) + tail.size() * sizeof(std::uint64_t);
+        }
+
+        template<class F>
+        void Unpack(std::size_t first, std::size_t count, const F& func) const
+        {
+            for (auto index = first, last = first + count; index != last;)
+            {
+                auto b = index / BlockSize;
+                auto n = std::min(last, (b + 1) * BlockSize) - index;
+
+                if (b == blocks.size())
+                {
+                    for (std::size_t i = 0; i != n; ++i)
+                    {
+                        func(index - first + i, tail[index % BlockSize + i]);
+                    }
+                }
+                else
+                {
+                    auto&& block = blocks[b];
+
+                    auto mask = block.width == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << block.width) - 1;
+
+                    for (std::size_t i = 0, j = index % BlockSize; i != n; ++i, ++j)
+                    {
+                        auto value = std::uint64_t(0);
+
+                        if (block.width != 0)
+                        {
+                            auto bit   = j * block.width;
+                            auto word  = block.offset + bit / 64;
+                            auto shift = bit % 64;
+
+                            value = words[word] >> shift;
+
+                            if (shift + block.width > 64)
+                            {
+                                value |= words[word + 1] << (64 - shift);
+                            }
+                        }
+
+                        func(index - first + i, (value & mask) + block.min);
+                    }
+                }
+
+                index += n;
+            }
+        }
+    };
+
+    struct ColumnHelper final
+    {
+        public:
+        // Element bytes of a value range plus whatever the values own on the heap, such as long strings.
+        template<class T>
+        static auto Bytes(const std::vector<T>& values) noexcept -> std::size_t
+        {
+            auto result = values.size() * sizeof(T);
+
+            if constexpr (requires(const T& e) { e.capacity(); e.data(); })
+            {
+                for (auto&& e : values)
+                {
+                    auto data = reinterpret_cast<const std::byte*>(e.data());
+                    auto self = reinterpret_cast<const std::byte*>(std::addressof(e));
+
+                    if (data < self || data >= self + sizeof(T))
+                    {
+                        result += (e.capacity() + 1) * sizeof(*e.data());
+                    }
+                }
+            }
+
+            return result;
+        }
+    };
+
+    template<class T>
+    struct PlainColumn final
+    {
+        public:
+        using Type = T;
+
+        private:
+        std::vector<T> values;
+
+        public:
+        void PushBack(const T& value)
+        {
+            values.push_back(value);
+        }
+
+        auto Size() const noexcept -> std::size_t
+        {
+            return values.size();
+        }
+
+        auto Bytes() const noexcept -> std::size_t
+        {
+            return ColumnHelper::Bytes(values);
+        }
+
+        auto Get(std::size_t index) const -> T
+        {
+            return values[index];
+        }
+
+        void Decode(std::size_t first, std::span<T> out) const
+        {
+            std::copy_n(values.begin() + static_cast<std::ptrdiff_t>(first), out.size(), out.begin());
+        }
+    };
+
+    template<class T>
+    requires(std::is_integral_v<T> && !std::is_same_v<T, bool>)
+    struct ForColumn final
+    {
+        public:
+        using Type = T;
+
+        private:
+        inline static constexpr std::uint64_t Bias = std::is_signed_v<T> ? std::uint64_t(1) << 63 : 0;
+
+        PackedBlocks packed;
+
+        public:
+        void PushBack(const T& value)
+        {
+            packed.Push(static_cast<std::uint64_t>(value) + Bias);
+        }
+
+        auto Size() const noexcept -> std::size_t
+        {
+            return packed.Size();
+        }
+
+        auto Bytes() const noexcept -> std::size_t
+        {
+            return packed.Bytes();
+        }
+
+        auto Get(std::size_t index) const -> T
+        {
+            auto result = T();
+
+            Decode(index, std::span<T>(&result, 1));
+
+            return result;
+        }
+
+        void Decode(std::size_t first, std::span<T> out) const
+        {
+            packed.Unpack(first, out.size(), [&](std::size_t i, std::uint64_t value)
+            {
+                out[i] = static_cast<T>(value - Bias);
+            });
+        }
+    };
+
+    template<class T>
+    requires(std::is_integral_v<T> && !std::is_same_v<T, bool>)
+    struct DeltaColumn final
+    {
+        public:
+        using Type = T;
+
+        private:
+        inline static constexpr std::uint64_t Bias = std::uint64_t(1) << 63;
+
+        PackedBlocks packed;
+
+        std::vector<std::uint64_t> firsts;
+
+        std::uint64_t last = 0;
+
+        public:
+        void PushBack(const T& value)
+        {
+            auto current = static_cast<std::uint64_t>(value);
+
+            if (packed.Size() % PackedBlocks::BlockSize == 0)
+            {
+                firsts.push_back(current);
+
+                last = current;
+            }
+
+            packed.Push(current - last + Bias);
+
+            last = current;
+        }
+
+        auto Size() const noexcept -> std::size_t
+        {
+            return packed.Size();
+        }
+
+        auto Bytes() const noexcept -> std::size_t
+        {
+            return packed.Bytes() + firsts.size() * sizeof(std::uint64_t);
+        }
+
+        auto Get(std::size_t index) const -> T
+        {
+            auto result = T();
+
+            Decode(index, std::span<T>(&result, 1));
+
+            return result;
+        }
+
+        void Decode(std::size_t first, std::span<T> out) const
+        {
+            auto start = first - first % PackedBlocks::BlockSize;
+            auto value = std::uint64_t(0);
+
+            packed.Unpack(start, first + out.size() - start, [&](std::size_t i, std::uint64_t delta)
+            {
+                auto index = start + i;
+
+                value = index % PackedBlocks::BlockSize ? value + delta - Bias : firsts[index / PackedBlocks::BlockSize];
+
+                if (index >= first)
+                {
+                    out[index - first] = static_cast<T>(value);
+                }
+            });
+        }
+    };
+
+    template<class T>
+    struct DictColumn final
+    {
+        public:
+        using Type = T;
+
+        private:
+        std::vector<T> values;
+
+        // Open-addressed index into values: each slot holds code + 1, or 0 when empty, so every distinct value is
+        // stored once and the index costs 4 bytes per slot at a load factor of at most 1/2.
+        std::vector<std::uint32_t> slots;
+
+        PackedBlocks packed;
+
+        void rehash(std::size_t size)
+        {
+            auto next = std::vector<std::uint32_t>(size);
+
+            for (std::size_t code = 0; code != values.size(); ++code)
+            {
+                auto i = std::hash<T>()(values[code]) & (size - 1);
+
+                while (next[i] != 0)
+                {
+                    i = (i + 1) & (size - 1);
+                }
+
+                next[i] = static_cast<std::uint32_t>(code + 1);
+            }
+
+            slots = std::move(next);
+        }
+
+        public:
+        void PushBack(const T& value)
+        {
+            if ((values.size() + 1) * 2 > slots.size())
+            {
+                rehash(std::max(slots.size() * 2, std::size_t(16)));
+            }
+
+            auto i = std::hash<T>()(value) & (slots.size() - 1);
+
+            while (slots[i] != 0 && !(values[slots[i] - 1] == value))
+            {
+                i = (i + 1) & (slots.size() - 1);
+            }
+
+            if (slots[i] == 0)
+            {
+                values.push_back(value);
+
+                slots[i] = static_cast<std::uint32_t>(values.size());
+            }
+
+            packed.Push(slots[i] - 1);
+        }
+
+        auto Size() const noexcept -> std::size_t
+        {
+            return packed.Size();
+        }
+
+        auto Bytes() const noexcept -> std::size_t
+        {
+            return packed.Bytes() + ColumnHelper::Bytes(values) + slots.size() * sizeof(std::uint32_t);
+        }
+
+        auto Cardinality() const noexcept -> std::size_t
+        {
+            return values.size();
+        }
+
+        auto Get(std::size_t index) const -> T
+        {
+            auto result = T();
+
+            Decode(index, std::span<T>(&result, 1));
+
+            return result;
+        }
+
+        void Decode(std::size_t first, std::span<T> out) const
+        {
+            packed.Unpack(first, out.size(), [&](std::size_t i, std::uint64_t code)
+            {
+                out[i] = values[code];
+            });
+        }
+    };
+
+    template<class T>
+    struct RleColumn final
+    {
+        public:
+        using Type = T;
+
+        private:
+        std::vector<T> values;
+
+        std::vector<std::size_t> ends;
+
+        public:
+        void PushBack(const T& value)
+        {
+            if (values.empty() || !(values.back() == value))
+            {
+                values.push_back(value);
+
+                ends.push_back(ends.empty() ? 0 : ends.back());
+            }
+
+            ++ends.back();
+        }
+
+        auto Size() const noexcept -> std::size_t
+        {
+            return ends.empty() ? 0 : ends.back();
+        }
+
+        auto Bytes() const noexcept -> std::size_t
+        {
+            return ColumnHelper::Bytes(values) + ends.size() * sizeof(std::size_t);
+        }
+
+        auto Runs() const noexcept -> std::size_t
+        {
+            return values.size();
+        }
+
+        auto Get(std::size_t index) const -> T
+        {
+            return values[static_cast<std::size_t>(std::upper_bound(ends.begin(), ends.end(), index) - ends.begin())];
+        }
+
+        void Decode(std::size_t first, std::span<T> out) const
+        {
+            auto run = static_cast<std::size_t>(std::upper_bound(ends.begin(), ends.end(), first) - ends.begin());
+
+            for (std::size_t i = 0; i != out.size();)
+            {
+                auto n = std::min(out.size() - i, ends[run] - first - i);
+
+                std::fill_n(out.begin() + static_cast<std::ptrdiff_t>(i), n, values[run]);
+
+                i += n;
+
+                ++run;
+            }
+        }
+    };
+
+    template<class... C>
+    requires(sizeof...(C) != 0)
+    struct TupleColumns final
+    {
+        public:
+        using Value = Tuple<typename C::Type...>;
+
+        static constexpr auto Count = sizeof...(C);
+
+        static constexpr auto BatchSize = PackedBlocks::BlockSize;
+
+        template<std::size_t I>
+        requires(I < Count)
+        using ElementType = typename TupleHelper<Value>::template ElementType<I>;
+
+        template<std::size_t I>
+        requires(I < Count)
+        using ColumnType = typename TupleHelper<Tuple<C...>>::template ElementType<I>;
+
+        private:
+        using Buffer = Tuple<std::vector<typename C::Type>...>;
+
+        Tuple<C...> columns;
+
+        std::size_t size = 0;
+
+        void decode(std::size_t first, Buffer& buffer) const
+        {
+            auto count = std::min(BatchSize, size - first);
+
+            [&]<std::size_t... I_>(std::index_sequence<I_...>) constexpr
+            {
+                (buffer.template IndexOf<I_>().resize(count), ...);
+
+                (columns.template IndexOf<I_>().Decode(first, std::span<ElementType<I_>>(buffer.template IndexOf<I_>())), ...);
+            }
+            (std::make_index_sequence<Count>{});
+        }
+
+        public:
+        struct Iterator final
+        {
+            friend struct TupleColumns;
+
+            public:
+            using iterator_concept = std::input_iterator_tag;
+
+            using difference_type  = std::ptrdiff_t;
+
+            using value_type       = Value;
+
+            private:
+            const TupleColumns* columns = nullptr;
+
+            std::size_t row = 0;
+
+            std::unique_ptr<Buffer> buffer;
+
+            explicit Iterator(const TupleColumns* columns_):
+                columns { columns_ },
+                buffer  { std::make_unique<Buffer>() }
+            {
+                if (columns->size != 0)
+                {
+                    columns->decode(0, *buffer);
+                }
+            }
+
+            public:
+            Iterator() = default;
+
+            public:
+            auto operator*() const -> Value
+            {
+                return [&]<std::size_t... I_>(std::index_sequence<I_...>) constexpr
+                {
+                    return Value(buffer->template IndexOf<I_>()[row % BatchSize]...);
+                }
+                (std::make_index_sequence<Count>{});
+            }
+
+            auto operator++() -> Iterator&
+            {
+                if (++row % BatchSize == 0 && row < columns->size)
+                {
+                    columns->decode(row, *buffer);
+                }
+
+                return *this;
+            }
+
+            void operator++(int)
+            {
+                ++*this;
+            }
+
+            friend auto operator==(const Iterator& lhs, std::default_sentinel_t) noexcept -> bool
+            {
+                return !lhs.columns || lhs.row >= lhs.columns->Size();
+            }
+        };
+
+        public:
+        auto begin() const -> Iterator
+        {
+            return Iterator(this);
+        }
+
+        auto end() const noexcept -> std::default_sentinel_t
+        {
+            return std::default_sentinel;
+        }
+
+        void PushBack(const Value& value)
+        {
+            [&]<std::size_t... I_>(std::index_sequence<I_...>) constexpr
+            {
+                (columns.template IndexOf<I_>().PushBack(value.template IndexOf<I_>()), ...);
+            }
+            (std::make_index_sequence<Count>{});
+
+            ++size;
+        }
+
+        auto Size() const noexcept -> std::size_t
+        {
+            return size;
+        }
+
+        auto Bytes() const noexcept -> std::size_t
+        {
+            auto result = std::size_t(0);
+
+            columns.ForEach([&](auto&& e) constexpr { result += e.Bytes(); });
+
+            return result;
+        }
+
+        template<std::size_t I>
+        requires(I < Count)
+        auto Column() const noexcept -> const ColumnType<I>&
+        {
+            return columns.template IndexOf<I>();
+        }
+
+        auto Get(std::size_t row) const -> Value
+        {
+            if (row >= size)
+            {
+                throw std::out_of_range("row out of range.");
+            }
+
+            return [&]<std::size_t... I_>(std::index_sequence<I_...>) constexpr
+            {
+                return Value(columns.template IndexOf<I_>().Get(row)...);
+            }
+            (std::make_index_sequence<Count>{});
+        }
+
+        template<std::size_t I>
+        requires(I < Count)
+        void Decode(std::size_t first, std::span<ElementType<I>> out) const
+        {
+            if (first > size || out.size() > size - first)
+            {
+                throw std::out_of_range("rows out of range.");
+            }
+
+            columns.template IndexOf<I>().Decode(first, out);
+        }
+
+        template<class F>
+        void ForEachBatch(const F& func) const
+        {
+            auto buffer = Buffer();
+
+            for (std::size_t first = 0; first < size; first += BatchSize)
+            {
+                decode(first, buffer);
+
+                [&]<std::size_t... I_>(std::index_sequence<I_...>) constexpr
+                {
+                    func(std::span<const ElementType<I_>>(buffer.template IndexOf<I_>())...);
+                }
+                (std::make_index_sequence<Count>{});
+            }
+        }
+    };
+}
+
+#ifdef  D_AKR_TEST
+#include "tuple_diff.hh"
+
+#include <string>
+
+namespace akr::test
+{
+    AKR_TEST(TupleColumns,
+    {
+        using C1 = TupleColumns<DeltaColumn<std::int64_t>, DictColumn<std::string>, ForColumn<int>, RleColumn<char>, PlainColumn<double>>;
+
+        auto rows = std::vector<C1::Value>();
+        auto c1   = C1();
+        for (auto i = 0; i != 1024; ++i)
+        {
+            auto time   = std::int64_t(1700000000000) + i * 3 - (i % 7 == 0 ? 50 : 0);
+            auto status = std::string(i % 3 ? "ok" : "retry");
+            auto value  = (i % 50) - 25;
+            auto kind   = static_cast<char>('A' + i / 300);
+            rows.emplace_back(time, status, value, kind, i * 0.5);
+            c1.PushBack(rows.back());
+        }
+        static_assert(std::input_iterator<decltype(c1.begin())>);
+        AKR_CHECK(c1.Size() == 1024);
+        AKR_CHECK(c1.Column<1>().Cardinality() == 2);
+        AKR_CHECK(c1.Column<3>().Runs() == 4);
+        AKR_CHECK(c1.Column<0>().Bytes() * 4 < 1024 * sizeof(std::int64_t));
+        AKR_CHECK(c1.Column<2>().Bytes() * 4 < 1024 * sizeof(int));
+        AKR_CHECK(c1.Bytes() < rows.size() * sizeof(C1::Value));
+
+        for (std::size_t i = 0; i < rows.size(); i += 37)
+        {
+            AKR_CHECK(TupleDiff::Diff(c1.Get(i), rows[i]).none());
+        }
+
+        auto index = std::size_t(0);
+        for (auto&& e : c1)
+        {
+            AKR_CHECK(TupleDiff::Diff(e, rows[index]).none());
+            ++index;
+        }
+        AKR_CHECK(index == 1024);
+
+        auto times = std::vector<std::int64_t>(300);
+        c1.Decode<0>(250, times);
+        AKR_CHECK(times.front() == rows[250].IndexOf<0>());
+        AKR_CHECK(times.back () == rows[549].IndexOf<0>());
+
+        auto kinds = std::string(5, ' ');
+        c1.Decode<3>(298, std::span<char>(kinds));
+        AKR_CHECK(kinds == "AABBB");
+
+        auto batches = 0;
+        auto sum     = 0;
+        c1.ForEachBatch([&](auto&& time, auto&& status, auto&& value, auto&&, auto&&)
+        {
+            AKR_CHECK(time.size() == status.size());
+            for (auto&& e : value)
+            {
+                sum += e;
+            }
+            ++batches;
+        });
+        AKR_CHECK(batches == 8);
+        AKR_CHECK(sum == -824);
+
+        auto thrown = false;
+        try
+        {
+            c1.Get(1024);
+        }
+        catch (const std::out_of_range&)
+        {
+            thrown = true;
+        }
+        AKR_CHECK(thrown);
+
+        auto d1 = DictColumn<std::string>();
+        for (auto i = 0; i != 300; ++i)
+        {
+            d1.PushBack(std::string(40, static_cast<char>('a' + i % 3)));
+        }
+        auto d2 = d1;
+        d2.PushBack(std::string(40, 'z'));
+        d2.PushBack(std::string(40, 'b'));
+        AKR_CHECK(d1.Cardinality() == 3 && d2.Cardinality() == 4);
+        AKR_CHECK(d2.Get(300) == std::string(40, 'z') && d2.Get(301) == d1.Get(1));
+        AKR_CHECK(d1.Bytes() >= 3 * (sizeof(std::string) + 41) + 16 * sizeof(std::uint32_t));
+        AKR_CHECK(d1.Bytes() < 300 * (sizeof(std::string) + 41));
+
+        auto c2 = TupleColumns<ForColumn<std::uint8_t>>();
+        AKR_CHECK(c2.begin() == c2.end());
+        c2.PushBack(Tuple(std::uint8_t(255)));
+        AKR_CHECK(c2.Get(0).IndexOf<0>() == 255);
+    });
+}
+#endif//D_AKR_TEST
+
+#endif//Z_AKR_TUPLE_COLUMNS_HH
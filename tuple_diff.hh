@@ -0,0 +1,160 @@
+#ifndef Z_AKR_TUPLE_DIFF_HH
+#define Z_AKR_TUPLE_DIFF_HH
+
+#include "tuple.hh"
+
+#include <bitset>
+#include <cstring>
+
+namespace akr
+{
+    U_AKR_TUPLE_EXPORT struct TupleDiff final
+    {
+        public:
+        template<class T1, class T2>
+        requires(TupleHelper<T1>::IsTuple && TupleHelper<T2>::IsTuple
+                 && TupleHelper<T1>::CountOf() == TupleHelper<T2>::CountOf())
+        static constexpr auto Diff(const T1& tuple1, const T2& tuple2) -> std::bitset<TupleHelper<T1>::CountOf()>
+        {
+            constexpr auto count = TupleHelper<T1>::CountOf();
+
+            if constexpr (std::is_same_v<T1, T2> && TupleDiff::isBitwiseComparable<T1>())
+            {
+                if (!std::is_constant_evaluated() && !std::memcmp(&tuple1, &tuple2, sizeof(T1)))
+                {
+                    return {};
+                }
+            }
+
+            if constexpr (count <= 64)
+            {
+                auto mask = 0ull;
+
+                if constexpr (std::is_same_v<T1, T2> && TupleHelper<T1>::IsHomogeneous && TupleDiff::isBitwiseComparable<T1>())
+                {
+                    auto&& lhs = tuple1.Span();
+                    auto&& rhs = tuple2.Span();
+
+                    for (std::size_t i = 0; i != count; ++i)
+                    {
+                        mask |= static_cast<unsigned long long>(lhs[i] != rhs[i]) << i;
+                    }
+                }
+                else
+                {
+                    [&]<std::size_t... I_>(std::index_sequence<I_...>) constexpr
+                    {
+                        (..., (mask |= static_cast<unsigned long long>(
+                            !(tuple1.template IndexOf<I_>() == tuple2.template IndexOf<I_>())) << I_));
+                    }
+                    (std::make_index_sequence<count>{});
+                }
+
+                return std::bitset<count>(mask);
+            }
+            else
+            {
+                auto diff = std::bitset<count>();
+
+                [&]<std::size_t... I_>(std::index_sequence<I_...>)
+                {
+                    (..., diff.set(I_, !(tuple1.template IndexOf<I_>() == tuple2.template IndexOf<I_>())));
+                }
+                (std::make_index_sequence<count>{});
+
+                return diff;
+            }
+        }
+
+        template<class T1, class T2>
+        requires(TupleHelper<T1>::IsTuple && TupleHelper<T2>::IsTuple
+                 && TupleHelper<T1>::CountOf() == TupleHelper<T2>::CountOf())
+        static constexpr void Patch(T1& tuple1, const std::bitset<TupleHelper<T1>::CountOf()>& diff, T2&& tuple2)
+        {
+            [&]<std::size_t... I_>(std::index_sequence<I_...>) constexpr
+            {
+                (..., (diff[I_] ? static_cast<void>(tuple1.template IndexOf<I_>() = static_cast<
+                    typename TupleHelper<T2&&>::template ForwardType<I_>>(tuple2.template IndexOf<I_>())) : void()));
+            }
+            (std::make_index_sequence<TupleHelper<T1>::CountOf()>{});
+        }
+
+        private:
+        // Equal bytes imply operator== only for scalars without padding or multiple representations; class types
+        // may define their own equality, so they always go through operator==.
+        template<class T>
+        static consteval auto isBitwiseComparable() noexcept -> bool
+        {
+            return std::has_unique_object_representations_v<T> && [&]<std::size_t... I_>(std::index_sequence<I_...>)
+            {
+                return (... && [&]<class E>(std::type_identity<E>)
+                {
+                    return std::is_arithmetic_v<E> || std::is_enum_v<E> || std::is_pointer_v<E>;
+                }
+                (std::type_identity<typename TupleHelper<T>::template ElementType<I_>>{}));
+            }
+            (std::make_index_sequence<TupleHelper<T>::CountOf()>{});
+        }
+    };
+}
+
+#ifdef  D_AKR_TEST
+#include <string>
+
+namespace akr::test
+{
+    AKR_TEST(TupleDiff,
+    {
+        constexpr auto c1 = TupleDiff::Diff(Tuple(1, 'A', 3.0), Tuple(1, 'B', 3.0));
+        static_assert(!c1[0] && c1[1] && !c1[2]);
+
+        constexpr auto c2 = TupleDiff::Diff(Tuple(1, 2, 3, 4), Tuple(1, 2, 0, 0));
+        static_assert(!c2[0] && !c2[1] && c2[2] && c2[3]);
+
+        auto t1 = Tuple(1, std::string("A"), 3.14, 7ll);
+        auto t2 = Tuple(1, std::string("B"), 3.14, 8ll);
+
+        auto d1 = TupleDiff::Diff(t1, t2);
+        static_assert(std::is_same_v<std::bitset<4>, decltype(d1)>);
+        AKR_CHECK(d1.count() == 2);
+        AKR_CHECK(d1.test(1));
+        AKR_CHECK(d1.test(3));
+
+        AKR_CHECK(TupleDiff::Diff(t1, t1).none());
+        AKR_CHECK(TupleDiff::Diff(t1, Tuple(1, "A", 3.14f, 7)).test(2));
+
+        TupleDiff::Patch(t1, d1, t2);
+        AKR_CHECK(t1.IndexOf<1>() == "B");
+        AKR_CHECK(t1.IndexOf<3>() == 8);
+        AKR_CHECK(TupleDiff::Diff(t1, t2).none());
+
+        auto t3 = Tuple(std::string("C"), std::string("D"));
+        auto t4 = Tuple(std::string(), std::string());
+        TupleDiff::Patch(t4, std::bitset<2>(0b10), std::move(t3));
+        AKR_CHECK(t4.IndexOf<0>().empty());
+        AKR_CHECK(t4.IndexOf<1>() == "D");
+
+        auto h1 = Tuple(1, 2, 3, 4, 5, 6, 7, 8);
+        auto h2 = h1;
+        AKR_CHECK(TupleDiff::Diff(h1, h2).none());
+        h2.IndexOf<5>() = 0;
+        AKR_CHECK(TupleDiff::Diff(h1, h2).to_ullong() == 0b100000);
+
+        struct Versioned
+        {
+            int value;
+            int version;
+
+            auto operator==(const Versioned& rhs) const noexcept -> bool { return value == rhs.value && version < 0; }
+        };
+        static_assert(std::has_unique_object_representations_v<Tuple<Versioned, int>>);
+
+        auto v1 = Tuple(Versioned { 1, 0 }, 2);
+        AKR_CHECK(TupleDiff::Diff(v1, v1).to_ullong() == 0b01);
+        auto v2 = Tuple(Versioned { 1, 0 }, Versioned { 1, -1 });
+        AKR_CHECK(TupleDiff::Diff(v2, v2).to_ullong() == 0b01);
+    });
+}
+#endif//D_AKR_TEST
+
+#endif//Z_AKR_TUPLE_DIFF_HH
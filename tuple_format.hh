@@ -0,0 +1,259 @@
+#ifndef Z_AKR_TUPLE_FORMAT_HH
+#define Z_AKR_TUPLE_FORMAT_HH
+
+#include "tuple.hh"
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#if __has_include(<format>)
+#include <format>
+#endif
+
+namespace akr
+{
+    U_AKR_TUPLE_EXPORT struct TupleFormat final
+    {
+        public:
+        template<class O>
+        struct FormatToNResult final
+        {
+            public:
+            O out;
+
+            std::ptrdiff_t size;
+        };
+
+        private:
+        // Writes at most limit characters through out and counts every character it is given.
+        template<class O>
+        struct Bounded final
+        {
+            public:
+            O out;
+
+            std::ptrdiff_t limit;
+
+            std::ptrdiff_t size;
+
+            public:
+            auto operator*()    noexcept -> Bounded&
+            {
+                return *this;
+            }
+
+            auto operator++()   noexcept -> Bounded&
+            {
+                return *this;
+            }
+
+            auto operator++(int) noexcept -> Bounded&
+            {
+                return *this;
+            }
+
+            auto operator=(char c) -> Bounded&
+            {
+                if (size++ < limit)
+                {
+                    *out++ = c;
+                }
+
+                return *this;
+            }
+        };
+
+        public:
+        template<class O, class T>
+        requires(TupleHelper<T>::IsTuple)
+        static auto FormatTo(O out, const T& tuple) -> O
+        {
+            *out++ = '(';
+
+            [&]<std::size_t... I_>(std::index_sequence<I_...>)
+            {
+                (..., (out = TupleFormat::formatElement(I_ == 0 ? out : TupleFormat::formatText(out, ", "),
+                                                        tuple.template IndexOf<I_>())));
+            }
+            (std::make_index_sequence<TupleHelper<T>::CountOf()>{});
+
+            *out++ = ')';
+
+            return out;
+        }
+
+        // Like std::format_to_n: writes at most n characters and returns the end of the output together with the
+        // size the full text would have had.
+        template<class O, class T>
+        requires(TupleHelper<T>::IsTuple)
+        static auto FormatToN(O out, std::ptrdiff_t n, const T& tuple) -> FormatToNResult<O>
+        {
+            auto bounded = TupleFormat::FormatTo(Bounded<O> { out, n < 0 ? 0 : n, 0 }, tuple);
+
+            return { bounded.out, bounded.size };
+        }
+
+        template<class T>
+        requires(TupleHelper<T>::IsTuple)
+        static auto ToString(const T& tuple) -> std::string
+        {
+            auto string = std::string();
+
+            TupleFormat::FormatTo(std::back_inserter(string), tuple);
+
+            return string;
+        }
+
+        private:
+        template<class O>
+        static auto formatText(O out, std::string_view text) -> O
+        {
+            for (auto&& e : text)
+            {
+                *out++ = e;
+            }
+
+            return out;
+        }
+
+        template<class O, class E>
+        static auto formatElement(O out, const E& element) -> O
+        {
+            if constexpr (TupleHelper<E>::IsTuple)
+            {
+                return TupleFormat::FormatTo(out, element);
+            }
+            else if constexpr (std::is_same_v<E, bool>)
+            {
+                return TupleFormat::formatText(out, element ? "true" : "false");
+            }
+            else if constexpr (std::is_same_v<E, char>)
+            {
+                *out++ = element;
+
+                return out;
+            }
+            else if constexpr (std::is_arithmetic_v<E>)
+            {
+                char buffer[64];
+
+                auto result = std::to_chars(buffer, buffer + sizeof(buffer), element);
+
+                return TupleFormat::formatText(out, std::string_view(buffer, result.ptr));
+            }
+            else if constexpr (std::is_enum_v<E>)
+            {
+                return TupleFormat::formatElement(out, static_cast<std::underlying_type_t<E>>(element));
+            }
+            else if constexpr (std::is_same_v<E, std::nullptr_t>)
+            {
+                return TupleFormat::formatText(out, "nullptr");
+            }
+            else if constexpr (std::is_convertible_v<const E&, std::string_view>)
+            {
+                if constexpr (std::is_pointer_v<E>)
+                {
+                    if (!element)
+                    {
+                        return TupleFormat::formatText(out, "nullptr");
+                    }
+                }
+
+                return TupleFormat::formatText(out, std::string_view(element));
+            }
+            else if constexpr (std::is_pointer_v<E>)
+            {
+                char buffer[2 + sizeof(void*) * 2] { '0', 'x' };
+
+                auto result = std::to_chars(buffer + 2, buffer + sizeof(buffer),
+                                            reinterpret_cast<std::uintptr_t>(element), 16);
+
+                return TupleFormat::formatText(out, std::string_view(buffer, result.ptr));
+            }
+            else
+            {
+                static_assert(std::is_arithmetic_v<E>, "element type is not formattable.");
+            }
+        }
+    };
+}
+
+#if defined(__cpp_lib_format)
+template<class... T>
+struct std::formatter<akr::Tuple<T...>, char>
+{
+    public:
+    constexpr auto parse(std::format_parse_context& context) -> std::format_parse_context::iterator
+    {
+        if (context.begin() != context.end() && *context.begin() != '}')
+        {
+            throw std::format_error("invalid format for akr::Tuple.");
+        }
+
+        return context.begin();
+    }
+
+    template<class C>
+    auto format(const akr::Tuple<T...>& value, C& context) const -> typename C::iterator
+    {
+        return akr::TupleFormat::FormatTo(context.out(), value);
+    }
+};
+#endif
+
+#ifdef  D_AKR_TEST
+namespace akr::test
+{
+    AKR_TEST(TupleFormat,
+    {
+        char buffer[128];
+
+        auto t1 = Tuple(true, 'A', 123, -4.5, Tuple(1u, 2.25f), "ABC", nullptr, std::string("DE"));
+        auto r1 = TupleFormat::FormatToN(buffer, sizeof(buffer), t1);
+        AKR_CHECK(std::string_view(buffer, r1.out) == "(true, A, 123, -4.5, (1, 2.25), ABC, nullptr, DE)");
+        AKR_CHECK(r1.size == r1.out - buffer);
+
+        auto r2 = TupleFormat::FormatToN(buffer, 8, t1);
+        AKR_CHECK(r2.out == buffer + 8);
+        AKR_CHECK(r2.size == r1.size);
+        AKR_CHECK(std::string_view(buffer, r2.out) == "(true, A");
+
+        auto r3 = TupleFormat::FormatToN(buffer, 0, Tuple(std::string(200, 'x')));
+        AKR_CHECK(r3.out == buffer);
+        AKR_CHECK(r3.size == 202);
+
+        enum class E1: std::uint8_t { A = 7 };
+        AKR_CHECK(TupleFormat::ToString(Tuple(E1::A, std::int8_t(-1), 1e100, 0.1)) == "(7, -1, 1e+100, 0.1)");
+
+        auto p1 = reinterpret_cast<const int*>(std::uintptr_t(0xABC));
+        AKR_CHECK(TupleFormat::ToString(Tuple(p1)) == "(0xabc)");
+        AKR_CHECK(TupleFormat::ToString(Tuple()) == "()");
+
+        auto s1 = static_cast<const char*>(nullptr);
+        auto s2 = static_cast<char*>(nullptr);
+        AKR_CHECK(TupleFormat::ToString(Tuple(s1, s2, "")) == "(nullptr, nullptr, )");
+
+#if defined(__cpp_lib_format)
+        AKR_CHECK(std::format("{}", Tuple(1, "A", s1)) == "(1, A, nullptr)");
+        AKR_CHECK(std::format("<{}>", Tuple()) == "<()>");
+
+        auto thrown = false;
+        try
+        {
+            static_cast<void>(std::vformat("{:x}", std::make_format_args(t1)));
+        }
+        catch (const std::format_error&)
+        {
+            thrown = true;
+        }
+        AKR_CHECK(thrown);
+#endif
+    });
+}
+#endif//D_AKR_TEST
+
+#endif//Z_AKR_TUPLE_FORMAT_HH
@@ -0,0 +1,411 @@
+#ifndef Z_AKR_TUPLE_GENERATOR_HH
+#define Z_AKR_TUPLE_GENERATOR_HH
+
+#include "tuple.hh"
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace akr
+{
+    template<class V>
+    struct BasicTupleGenerator final
+    {
+        public:
+        struct promise_type final
+        {
+            friend struct BasicTupleGenerator;
+
+            private:
+            V* value = nullptr;
+
+            // Holds a copy of an lvalue yield in the frame so the consumer can still move from it.
+            struct CopyAwaiter final
+            {
+                V copy;
+
+                promise_type& promise;
+
+                auto await_ready() const noexcept -> bool
+                {
+                    return false;
+                }
+
+                void await_suspend(std::coroutine_handle<promise_type>) noexcept
+                {
+                    promise.value = std::addressof(copy);
+                }
+
+                void await_resume() const noexcept
+                {
+                }
+            };
+
+            std::exception_ptr exception {};
+
+            public:
+            auto get_return_object() noexcept -> BasicTupleGenerator
+            {
+                return BasicTupleGenerator(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            auto initial_suspend() noexcept -> std::suspend_always
+            {
+                return {};
+            }
+
+            auto final_suspend() noexcept -> std::suspend_always
+            {
+                return {};
+            }
+
+            auto yield_value(V&& value_) noexcept -> std::suspend_always
+            {
+                value = std::addressof(value_);
+
+                return {};
+            }
+
+            auto yield_value(const V& value_) -> CopyAwaiter
+            {
+                return CopyAwaiter { value_, *this };
+            }
+
+            void return_void() noexcept
+            {
+            }
+
+            void unhandled_exception() noexcept
+            {
+                exception = std::current_exception();
+            }
+
+            template<class A>
+            void await_transform(A&&) = delete;
+        };
+
+        struct Iterator final
+        {
+            friend struct BasicTupleGenerator;
+
+            public:
+            using iterator_category = std::input_iterator_tag;
+
+            using difference_type   = std::ptrdiff_t;
+
+            using value_type        = V;
+
+            private:
+            std::coroutine_handle<promise_type> handle {};
+
+            explicit Iterator(std::coroutine_handle<promise_type> handle_) noexcept:
+                handle { handle_ }
+            {
+            }
+
+            public:
+            Iterator() = default;
+
+            public:
+            auto operator*() const noexcept -> V&
+            {
+                return *handle.promise().value;
+            }
+
+            auto operator->() const noexcept -> V*
+            {
+                return handle.promise().value;
+            }
+
+            auto operator++() -> Iterator&
+            {
+                BasicTupleGenerator::resume(handle);
+
+                return *this;
+            }
+
+            void operator++(int)
+            {
+                ++*this;
+            }
+
+            friend auto operator==(const Iterator& lhs, std::default_sentinel_t) noexcept -> bool
+            {
+                return !lhs.handle || lhs.handle.done();
+            }
+        };
+
+        private:
+        std::coroutine_handle<promise_type> handle;
+
+        explicit BasicTupleGenerator(std::coroutine_handle<promise_type> handle_) noexcept:
+            handle { handle_ }
+        {
+        }
+
+        static void resume(std::coroutine_handle<promise_type> handle)
+        {
+            handle.resume();
+
+            if (auto&& exception = handle.promise().exception)
+            {
+                std::rethrow_exception(std::exchange(exception, nullptr));
+            }
+        }
+
+        template<class F>
+        static auto filter(BasicTupleGenerator source, F func) -> BasicTupleGenerator
+        {
+            for (auto&& e : source)
+            {
+                if (func(std::as_const(e)))
+                {
+                    co_yield std::move(e);
+                }
+            }
+        }
+
+        // Moves element I out of e unless the projection names it more than once.
+        template<std::size_t I, std::size_t... P>
+        static auto projectOne(V& e) noexcept -> decltype(auto)
+        {
+            if constexpr ((std::size_t(0) + ... + (I == P)) == 1)
+            {
+                return std::move(e.template IndexOf<I>());
+            }
+            else
+            {
+                return std::as_const(e.template IndexOf<I>());
+            }
+        }
+
+        template<std::size_t... I>
+        static auto project(BasicTupleGenerator source)
+            -> BasicTupleGenerator<Tuple<typename TupleHelper<V>::template ElementType<I>...>>
+        {
+            for (auto&& e : source)
+            {
+                co_yield Tuple<typename TupleHelper<V>::template ElementType<I>...>(BasicTupleGenerator::projectOne<I, I...>(e)...);
+            }
+        }
+
+        static auto batch(BasicTupleGenerator source, std::size_t count) -> BasicTupleGenerator<std::span<const V>>
+        {
+            // clear() keeps the capacity, so after the first batch elements are only moved into it.
+            auto buffer = std::vector<V>();
+
+            buffer.reserve(count);
+
+            for (auto&& e : source)
+            {
+                buffer.push_back(std::move(e));
+
+                if (buffer.size() == count)
+                {
+                    co_yield std::span<const V>(buffer);
+
+                    buffer.clear();
+                }
+            }
+
+            if (!buffer.empty())
+            {
+                co_yield std::span<const V>(buffer);
+            }
+        }
+
+        public:
+        BasicTupleGenerator(BasicTupleGenerator&& rhs) noexcept:
+            handle { std::exchange(rhs.handle, nullptr) }
+        {
+        }
+
+        ~BasicTupleGenerator()
+        {
+            if (handle)
+            {
+                handle.destroy();
+            }
+        }
+
+        public:
+        auto operator=(BasicTupleGenerator&& rhs) noexcept -> BasicTupleGenerator&
+        {
+            std::swap(handle, rhs.handle);
+
+            return *this;
+        }
+
+        public:
+        auto begin() -> Iterator
+        {
+            BasicTupleGenerator::resume(handle);
+
+            return Iterator(handle);
+        }
+
+        auto end() noexcept -> std::default_sentinel_t
+        {
+            return std::default_sentinel;
+        }
+
+        template<class F>
+        auto Filter(F func) && -> BasicTupleGenerator
+        {
+            return BasicTupleGenerator::filter(std::move(*this), std::move(func));
+        }
+
+        template<std::size_t... I>
+        requires(TupleHelper<V>::IsTuple && sizeof...(I) != 0 && (... && (I < TupleHelper<V>::CountOf())))
+        auto Project() &&
+        {
+            return BasicTupleGenerator::project<I...>(std::move(*this));
+        }
+
+        auto Batch(std::size_t count) && -> BasicTupleGenerator<std::span<const V>>
+        {
+            if (count == 0)
+            {
+                throw std::invalid_argument("batch size is zero.");
+            }
+
+            return BasicTupleGenerator::batch(std::move(*this), count);
+        }
+    };
+
+    template<class... T>
+    using TupleGenerator = BasicTupleGenerator<Tuple<T...>>;
+}
+
+#ifdef  D_AKR_TEST
+#include <string>
+
+namespace akr::test
+{
+    static auto TupleGeneratorSource(int count) -> TupleGenerator<int, std::string, double>
+    {
+        for (auto i = 0; i != count; ++i)
+        {
+            co_yield Tuple<>::Create(i, std::to_string(i), i * 0.5);
+        }
+    }
+
+    struct TupleGeneratorCopy final
+    {
+        inline static auto copies = 0;
+
+        std::string text;
+
+        explicit TupleGeneratorCopy(std::string text_): text { std::move(text_) } {}
+
+        TupleGeneratorCopy(const TupleGeneratorCopy& rhs): text { rhs.text } { ++copies; }
+
+        TupleGeneratorCopy(TupleGeneratorCopy&&) noexcept = default;
+
+        auto operator=(const TupleGeneratorCopy& rhs) -> TupleGeneratorCopy& { text = rhs.text; ++copies; return *this; }
+
+        auto operator=(TupleGeneratorCopy&&) noexcept -> TupleGeneratorCopy& = default;
+    };
+
+    static auto TupleGeneratorMoves(int count) -> TupleGenerator<int, TupleGeneratorCopy>
+    {
+        for (auto i = 0; i != count; ++i)
+        {
+            co_yield Tuple<>::Create(i, TupleGeneratorCopy(std::string(32, char('a' + i))));
+        }
+
+        auto last = Tuple<>::Create(count, TupleGeneratorCopy("last"));
+
+        co_yield last;
+    }
+
+    static auto TupleGeneratorThrow() -> TupleGenerator<int>
+    {
+        co_yield Tuple(1);
+
+        throw std::out_of_range("source failed.");
+    }
+
+    AKR_TEST(TupleGenerator,
+    {
+        auto sum = 0;
+        for (auto&& e : TupleGeneratorSource(10))
+        {
+            sum += e.IndexOf<0>();
+        }
+        AKR_CHECK(sum == 45);
+
+        auto p1 = (TupleGeneratorSource(10).Filter([](auto&& e) { return e.template IndexOf<0>() % 2 == 0; }).Project<2, 1>());
+        static_assert(std::is_same_v<TupleGenerator<double, std::string>, decltype(p1)>);
+
+        auto count = 0;
+        for (auto&& e : p1)
+        {
+            AKR_CHECK(e.IndexOf<0>() == count * 2 * 0.5);
+            AKR_CHECK(e.IndexOf<1>() == std::to_string(count * 2));
+            ++count;
+        }
+        AKR_CHECK(count == 5);
+
+        auto sizes = std::string();
+        for (auto&& batch : TupleGeneratorSource(7).Batch(3))
+        {
+            sizes += std::to_string(batch.size());
+            AKR_CHECK(batch.front().IndexOf<0>() % 3 == 0);
+        }
+        AKR_CHECK(sizes == "331");
+
+        TupleGeneratorCopy::copies = 0;
+        auto texts = std::string();
+        for (auto&& batch : TupleGeneratorMoves(5).Filter([](auto&& e) { return e.template IndexOf<0>() != 1; }).Batch(2))
+        {
+            for (auto&& e : batch)
+            {
+                texts += e.IndexOf<1>().text.front();
+            }
+        }
+        AKR_CHECK(texts == "acdel");
+        AKR_CHECK(TupleGeneratorCopy::copies == 1);
+
+        TupleGeneratorCopy::copies = 0;
+        auto p2 = std::string();
+        for (auto&& e : TupleGeneratorMoves(3).Project<1, 0>())
+        {
+            p2 += e.IndexOf<0>().text.front();
+        }
+        AKR_CHECK(p2 == "abcl");
+        AKR_CHECK(TupleGeneratorCopy::copies == 1);
+
+        auto p3 = 0;
+        for (auto&& e : TupleGeneratorMoves(2).Project<1, 1>())
+        {
+            AKR_CHECK(e.IndexOf<0>().text == e.IndexOf<1>().text);
+            ++p3;
+        }
+        AKR_CHECK(p3 == 3);
+
+        auto e1 = TupleGeneratorSource(0);
+        AKR_CHECK(e1.begin() == e1.end());
+
+        auto thrown = false;
+        try
+        {
+            for (auto&& e : TupleGeneratorThrow())
+            {
+                AKR_CHECK(e.IndexOf<0>() == 1);
+            }
+        }
+        catch (const std::out_of_range&)
+        {
+            thrown = true;
+        }
+        AKR_CHECK(thrown);
+    });
+}
+#endif//D_AKR_TEST
+
+#endif//Z_AKR_TUPLE_GENERATOR_HH
@@ -0,0 +1,423 @@
+#ifndef Z_AKR_TUPLE_INDEX_HH
+#define Z_AKR_TUPLE_INDEX_HH
+
+#include "tuple.hh"
+
+#include <algorithm>
+#include <bit>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <ranges>
+#include <vector>
+
+namespace akr
+{
+    template<std::size_t I, class V>
+    requires(TupleHelper<V>::IsTuple && I < TupleHelper<V>::CountOf())
+    struct TupleIndex final
+    {
+        public:
+        using Key = std::remove_cvref_t<typename TupleHelper<V>::template ElementType<I>>;
+
+        struct Iterator final
+        {
+            friend struct TupleIndex;
+
+            public:
+            using iterator_concept  = std::forward_iterator_tag;
+
+            using iterator_category = std::forward_iterator_tag;
+
+            using difference_type   = std::ptrdiff_t;
+
+            using value_type        = V;
+
+            using reference         = const V&;
+
+            using pointer           = const V*;
+
+            private:
+            const TupleIndex* index = nullptr;
+
+            std::size_t rank = 0;
+
+            std::size_t tailRank = 0;
+
+            explicit Iterator(const TupleIndex* index_, std::size_t rank_, std::size_t tailRank_) noexcept:
+                index    { index_    },
+                rank     { rank_     },
+                tailRank { tailRank_ }
+            {
+            }
+
+            // Rows from the tail come after built rows with an equal key, as they were appended later.
+            auto inTail() const noexcept -> bool
+            {
+                return tailRank != index->tail.size()
+                    && (rank == index->order.size() || index->keyOf(index->tail[tailRank]) < index->keyOf(index->order[rank]));
+            }
+
+            public:
+            Iterator() = default;
+
+            public:
+            auto operator*() const noexcept -> const V&
+            {
+                return (*index->rows)[Row()];
+            }
+
+            auto operator->() const noexcept -> const V*
+            {
+                return std::addressof(**this);
+            }
+
+            auto operator++() noexcept -> Iterator&
+            {
+                ++(inTail() ? tailRank : rank);
+
+                return *this;
+            }
+
+            auto operator++(int) noexcept -> Iterator
+            {
+                auto result = *this;
+
+                ++*this;
+
+                return result;
+            }
+
+            auto operator==(const Iterator& rhs) const noexcept -> bool
+            {
+                return rank == rhs.rank && tailRank == rhs.tailRank;
+            }
+
+            auto Row() const noexcept -> std::size_t
+            {
+                return inTail() ? index->tail[tailRank] : index->order[rank];
+            }
+        };
+
+        private:
+        const std::vector<V>* rows;
+
+        std::vector<std::size_t> order;
+
+        std::vector<Key> keys;
+
+        std::vector<std::size_t> ranks;
+
+        // Rows appended since the last layout, sorted by key and searched by bisection until they are merged in.
+        std::vector<std::size_t> tail;
+
+        auto keyOf(std::size_t row) const noexcept -> const Key&
+        {
+            return (*rows)[row].template IndexOf<I>();
+        }
+
+        void layout(std::size_t node, std::size_t& rank)
+        {
+            if (node <= keys.size())
+            {
+                layout(node * 2, rank);
+
+                keys [node - 1] = keyOf(order[rank]);
+                ranks[node - 1] = rank++;
+
+                layout(node * 2 + 1, rank);
+            }
+        }
+
+        void relayout()
+        {
+            keys .resize(order.size());
+            ranks.resize(order.size());
+
+            auto rank = std::size_t(0);
+
+            layout(1, rank);
+        }
+
+        auto search(const Key& key) const noexcept -> std::size_t
+        {
+            auto node = std::size_t(1);
+
+            while (node <= keys.size())
+            {
+                #if defined(__has_builtin)
+                #if __has_builtin(__builtin_prefetch)
+                __builtin_prefetch(keys.data() + std::min(node * 16, keys.size()) - 1);
+                #endif
+                #endif
+
+                node = node * 2 + (keys[node - 1] < key);
+            }
+
+            node >>= std::countr_one(node) + 1;
+
+            return node ? ranks[node - 1] : keys.size();
+        }
+
+        auto searchTail(const Key& key) const noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>(std::lower_bound(tail.begin(), tail.end(), key, [this](std::size_t row, const Key& key_)
+            {
+                return keyOf(row) < key_;
+            }) - tail.begin());
+        }
+
+        // About the square root of the built size, so appends cost O(sqrt(n)) each whether they land in the tail or
+        // trigger a merge and relayout.
+        auto tailLimit() const noexcept -> std::size_t
+        {
+            return std::max(std::size_t(64), std::size_t(1) << std::bit_width(order.size()) / 2);
+        }
+
+        public:
+        explicit TupleIndex(const std::vector<V>& rows_):
+            rows { std::addressof(rows_) }
+        {
+            Refresh();
+        }
+
+        explicit TupleIndex(const std::vector<V>&&) = delete;
+
+        public:
+        auto begin() const noexcept -> Iterator
+        {
+            return Iterator(this, 0, 0);
+        }
+
+        auto end() const noexcept -> Iterator
+        {
+            return Iterator(this, order.size(), tail.size());
+        }
+
+        auto Size() const noexcept -> std::size_t
+        {
+            return order.size() + tail.size();
+        }
+
+        auto LowerBound(const Key& key) const noexcept -> Iterator
+        {
+            return Iterator(this, search(key), searchTail(key));
+        }
+
+        auto Find(const Key& key) const noexcept -> const V*
+        {
+            auto it = LowerBound(key);
+
+            return it != end() && !(key < it->template IndexOf<I>()) ? std::addressof(*it) : nullptr;
+        }
+
+        auto Range(const Key& lower, const Key& upper) const noexcept -> std::ranges::subrange<Iterator>
+        {
+            auto first = LowerBound(lower);
+            auto last  = LowerBound(upper);
+
+            return { first, Iterator(this, std::max(first.rank, last.rank), std::max(first.tailRank, last.tailRank)) };
+        }
+
+        auto EqualRange(const Key& key) const noexcept -> std::ranges::subrange<Iterator>
+        {
+            auto first = LowerBound(key);
+            auto last  = first;
+
+            while (last.rank != order.size() && !(key < keyOf(order[last.rank])))
+            {
+                ++last.rank;
+            }
+
+            while (last.tailRank != tail.size() && !(key < keyOf(tail[last.tailRank])))
+            {
+                ++last.tailRank;
+            }
+
+            return { first, last };
+        }
+
+        // Adds the rows appended since the last call to a sorted tail, and merges the tail into the layout once it
+        // outgrows tailLimit. Rows edited in place or reordered are not detected; call Rebuild for those. If the vector
+        // has shrunk, Refresh rebuilds by itself.
+        void Refresh()
+        {
+            auto size = Size();
+
+            if (size > rows->size())
+            {
+                Rebuild();
+
+                return;
+            }
+
+            if (size == rows->size())
+            {
+                return;
+            }
+
+            auto less = [this](std::size_t lhs, std::size_t rhs) { return keyOf(lhs) < keyOf(rhs); };
+
+            auto pending = tail.size();
+
+            tail.resize(pending + rows->size() - size);
+
+            std::iota(tail.begin() + pending, tail.end(), size);
+
+            std::stable_sort  (tail.begin() + pending, tail.end(), less);
+            std::inplace_merge(tail.begin(), tail.begin() + pending, tail.end(), less);
+
+            if (tail.size() > tailLimit())
+            {
+                auto built = order.size();
+
+                order.insert(order.end(), tail.begin(), tail.end());
+
+                tail.clear();
+
+                std::inplace_merge(order.begin(), order.begin() + built, order.end(), less);
+
+                relayout();
+            }
+        }
+
+        void Rebuild()
+        {
+            tail.clear();
+
+            order.resize(rows->size());
+
+            std::iota(order.begin(), order.end(), std::size_t(0));
+
+            std::stable_sort(order.begin(), order.end(), [this](std::size_t lhs, std::size_t rhs)
+            {
+                return keyOf(lhs) < keyOf(rhs);
+            });
+
+            relayout();
+        }
+    };
+
+    template<std::size_t I, class V>
+    auto MakeTupleIndex(const std::vector<V>& rows) -> TupleIndex<I, V>
+    {
+        return TupleIndex<I, V>(rows);
+    }
+
+    template<std::size_t I, class V>
+    auto MakeTupleIndex(const std::vector<V>&&) -> TupleIndex<I, V> = delete;
+}
+
+#ifdef  D_AKR_TEST
+#include <string>
+
+namespace akr::test
+{
+    AKR_TEST(TupleIndex,
+    {
+        using V1 = decltype(Tuple(0, std::string()));
+
+        auto rows = std::vector<V1>({ V1(5, "A"), V1(2, "B"), V1(8, "C"), V1(2, "D"), V1(7, "E") });
+
+        auto i1 = MakeTupleIndex<0>(rows);
+        static_assert(std::forward_iterator<decltype(i1.begin())>);
+        AKR_CHECK(i1.Size() == 5);
+
+        auto order = std::string();
+        for (auto&& e : i1)
+        {
+            order += e.IndexOf<1>();
+        }
+        AKR_CHECK(order == "BDAEC");
+
+        AKR_CHECK(i1.Find(7) == &rows[4]);
+        AKR_CHECK(i1.Find(6) == nullptr);
+        AKR_CHECK(i1.Find(9) == nullptr);
+        AKR_CHECK(i1.LowerBound(6)->IndexOf<0>() == 7);
+        AKR_CHECK(i1.LowerBound(0).Row() == 1);
+        AKR_CHECK(i1.LowerBound(9) == i1.end());
+
+        order.clear();
+        for (auto&& e : i1.Range(2, 7))
+        {
+            order += e.IndexOf<1>();
+        }
+        AKR_CHECK(order == "BDA");
+        AKR_CHECK(i1.Range(8, 2).empty());
+        AKR_CHECK(std::ranges::distance(i1.EqualRange(2)) == 2);
+
+        rows.emplace_back(2, "F");
+        rows.emplace_back(6, "G");
+        rows.emplace_back(1, "H");
+        i1.Refresh();
+        AKR_CHECK(i1.Size() == 8);
+
+        order.clear();
+        for (auto&& e : i1)
+        {
+            order += e.IndexOf<1>();
+        }
+        AKR_CHECK(order == "HBDFAGEC");
+        AKR_CHECK(i1.Find(6) == &rows[6]);
+
+        rows.resize(3);
+        i1.Refresh();
+        AKR_CHECK(i1.Size() == 3);
+        AKR_CHECK(i1.Find(7) == nullptr);
+        AKR_CHECK(i1.Find(8) == &rows[2]);
+
+        rows[0].IndexOf<0>() = 9;
+        rows.emplace_back(5, "I");
+        i1.Rebuild();
+        order.clear();
+        for (auto&& e : i1)
+        {
+            order += e.IndexOf<1>();
+        }
+        AKR_CHECK(order == "BICA");
+        AKR_CHECK(i1.Find(9) == &rows[0]);
+
+        rows.emplace_back(7, "E");
+        rows.emplace_back(2, "D");
+        rows.emplace_back(6, "G");
+        rows.emplace_back(1, "H");
+
+        auto i2 = MakeTupleIndex<1>(rows);
+        AKR_CHECK(i2.Find("E")->IndexOf<0>() == 7);
+        AKR_CHECK(i2.LowerBound("Z") == i2.end());
+
+        auto many = std::vector<V1>();
+        auto i4 = MakeTupleIndex<0>(many);
+        auto seed = 1u;
+        for (auto round = 0; round != 300; ++round)
+        {
+            for (auto n = round % 5; n-- != 0;)
+            {
+                seed = seed * 1103515245u + 12345u;
+                many.emplace_back(static_cast<int>(seed >> 16) % 100, std::to_string(many.size()));
+            }
+            i4.Refresh();
+            AKR_CHECK(i4.Size() == many.size());
+        }
+
+        auto sorted = many;
+        std::ranges::stable_sort(sorted, {}, [](auto&& e) { return e.template IndexOf<0>(); });
+        AKR_CHECK(std::ranges::equal(i4, sorted, [](auto&& lhs, auto&& rhs) { return lhs.template IndexOf<1>() == rhs.template IndexOf<1>(); }));
+
+        for (auto key = -1; key != 101; ++key)
+        {
+            auto first = std::ranges::find_if(many, [&](auto&& e) { return e.template IndexOf<0>() == key; });
+            AKR_CHECK(i4.Find(key) == (first != many.end() ? &*first : nullptr));
+            AKR_CHECK(std::ranges::distance(i4.EqualRange(key)) == std::ranges::count_if(many, [&](auto&& e) { return e.template IndexOf<0>() == key; }));
+        }
+        AKR_CHECK(std::ranges::distance(i4.Range(10, 20)) == std::ranges::count_if(many, [](auto&& e) { return e.template IndexOf<0>() >= 10 && e.template IndexOf<0>() < 20; }));
+
+        auto empty = std::vector<V1>();
+        auto i3 = MakeTupleIndex<0>(empty);
+        AKR_CHECK(i3.Find(0) == nullptr);
+        AKR_CHECK(i3.begin() == i3.end());
+    });
+}
+#endif//D_AKR_TEST
+
+#endif//Z_AKR_TUPLE_INDEX_HH
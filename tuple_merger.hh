@@ -0,0 +1,360 @@
+#ifndef Z_AKR_TUPLE_MERGER_HH
+#define Z_AKR_TUPLE_MERGER_HH
+
+#include "tuple.hh"
+
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <vector>
+
+namespace akr
+{
+    template<class I, class S, std::size_t... K>
+    requires(std::input_iterator<I> && std::sentinel_for<S, I> && sizeof...(K) != 0
+             && TupleHelper<std::iter_value_t<I>>::IsTuple
+             && (... && (K < TupleHelper<std::iter_value_t<I>>::CountOf())))
+    struct TupleMerger final
+    {
+        public:
+        using Value = std::iter_value_t<I>;
+
+        using Key   = Tuple<std::remove_cvref_t<typename TupleHelper<Value>::template ElementType<K>>...>;
+
+        private:
+        inline static constexpr bool IsBuffered = !std::forward_iterator<I> || !std::is_lvalue_reference_v<std::iter_reference_t<I>>;
+
+        inline static constexpr bool IsCached   = std::is_trivially_copyable_v<Key> && std::is_default_constructible_v<Key>;
+
+        // Set in Node::run once a run is exhausted. It sorts exhausted runs after live ones without a key comparison,
+        // and keeps the run order among them.
+        inline static constexpr std::size_t Exhausted = ~(~std::size_t() >> 1);
+
+        inline static constexpr std::size_t PrefetchBytes = sizeof(Value) * 2 < 128 ? 128 : sizeof(Value) * 2;
+
+        struct Node final
+        {
+            public:
+            std::conditional_t<IsCached, Key, bool> key;
+
+            std::size_t run;
+        };
+
+        std::vector<I> cursors;
+
+        std::vector<S> ends;
+
+        std::vector<std::conditional_t<IsBuffered, std::optional<Value>, bool>> heads;
+
+        // tree[0] holds the winner, tree[1, runs) the loser of each match; keys are held inline when they are cached.
+        std::vector<Node> tree;
+
+        auto row(std::size_t index) -> Value&
+        {
+            if constexpr (IsBuffered)
+            {
+                return *heads[index];
+            }
+            else
+            {
+                return *cursors[index];
+            }
+        }
+
+        template<class L, class R, std::size_t... J>
+        static auto compare(const L& lhs, const R& rhs, std::index_sequence<J...>) -> int
+        {
+            auto result = 0;
+
+            (void)(... || ((lhs.template IndexOf<J>() < rhs.template IndexOf<J>()) ? (result = -1, true) :
+                           (rhs.template IndexOf<J>() < lhs.template IndexOf<J>()) ? (result = +1, true) : false));
+
+            return result;
+        }
+
+        // Lexicographic less on cached keys, falling back to tie. Built from non-short-circuit operations, so
+        // arithmetic keys compile to flag arithmetic instead of a chain of hard-to-predict branches.
+        template<std::size_t J, std::size_t... U>
+        static auto before(const Key& lhs, const Key& rhs, bool tie, std::index_sequence<J, U...>) -> bool
+        {
+            if constexpr (sizeof...(U) != 0)
+            {
+                tie = TupleMerger::before(lhs, rhs, tie, std::index_sequence<U...>());
+            }
+
+            auto&& l = lhs.template IndexOf<J>();
+            auto&& r = rhs.template IndexOf<J>();
+
+            return (l < r) | (!(r < l) & tie);
+        }
+
+        auto less(const Node& lhs, const Node& rhs) -> bool
+        {
+            if ((lhs.run | rhs.run) & Exhausted)
+            {
+                return lhs.run < rhs.run;
+            }
+
+            if constexpr (IsCached)
+            {
+                return TupleMerger::before(lhs.key, rhs.key, lhs.run < rhs.run, std::make_index_sequence<sizeof...(K)>());
+            }
+            else
+            {
+                auto result = TupleMerger::compare(row(lhs.run), row(rhs.run), std::index_sequence<K...>());
+
+                return result ? result < 0 : lhs.run < rhs.run;
+            }
+        }
+
+        auto build(std::size_t node, std::vector<Node>& leaves) -> Node
+        {
+            if (node >= leaves.size())
+            {
+                return leaves[node - leaves.size()];
+            }
+
+            auto lhs = build(node * 2,     leaves);
+            auto rhs = build(node * 2 + 1, leaves);
+
+            auto&& [winner, loser] = less(lhs, rhs) ? std::pair(lhs, rhs) : std::pair(rhs, lhs);
+
+            tree[node] = loser;
+
+            return winner;
+        }
+
+        void replay()
+        {
+            auto winner = tree[0];
+
+            for (auto node = ((winner.run & ~Exhausted) + tree.size()) / 2; node != 0; node /= 2)
+            {
+                if (less(tree[node], winner))
+                {
+                    std::swap(tree[node], winner);
+                }
+            }
+
+            tree[0] = winner;
+        }
+
+        void load(Node& node)
+        {
+            auto index = node.run;
+
+            if (cursors[index] == ends[index])
+            {
+                node.run |= Exhausted;
+
+                return;
+            }
+
+            if constexpr (IsBuffered)
+            {
+                heads[index] = std::move(*cursors[index]);
+            }
+
+            if constexpr (std::contiguous_iterator<I>)
+            {
+                // With dozens of runs the hardware prefetcher loses track of the streams, and every new line of a run
+                // would be a miss by the time its rows come up.
+                #if defined(__has_builtin)
+                #if __has_builtin(__builtin_prefetch)
+                __builtin_prefetch(reinterpret_cast<const char*>(std::to_address(cursors[index])) + PrefetchBytes);
+                #endif
+                #endif
+            }
+
+            if constexpr (IsCached)
+            {
+                auto&& value = row(index);
+
+                node.key = Key(value.template IndexOf<K>()...);
+            }
+        }
+
+        public:
+        struct Iterator final
+        {
+            friend struct TupleMerger;
+
+            public:
+            using iterator_category = std::input_iterator_tag;
+
+            using difference_type   = std::ptrdiff_t;
+
+            using value_type        = Value;
+
+            private:
+            TupleMerger* merger = nullptr;
+
+            explicit Iterator(TupleMerger* merger_) noexcept:
+                merger { merger_ }
+            {
+            }
+
+            auto done() const noexcept -> bool
+            {
+                return !merger || merger->tree.empty() || (merger->tree[0].run & Exhausted);
+            }
+
+            public:
+            Iterator() = default;
+
+            public:
+            auto operator*() const noexcept -> Value&&
+            {
+                return std::move(merger->row(merger->tree[0].run));
+            }
+
+            auto operator++() -> Iterator&
+            {
+                auto&& winner = merger->tree[0];
+
+                ++merger->cursors[winner.run];
+
+                merger->load(winner);
+                merger->replay();
+
+                return *this;
+            }
+
+            void operator++(int)
+            {
+                ++*this;
+            }
+
+            friend auto operator==(const Iterator& lhs, std::default_sentinel_t) noexcept -> bool
+            {
+                return lhs.done();
+            }
+        };
+
+        public:
+        explicit TupleMerger(std::vector<std::pair<I, S>> runs)
+        {
+            cursors.reserve(runs.size());
+            ends   .reserve(runs.size());
+
+            for (auto&& [begin, end] : runs)
+            {
+                cursors.push_back(std::move(begin));
+                ends   .push_back(std::move(end));
+            }
+
+            heads.resize(IsBuffered ? runs.size() : 0);
+            tree .resize(runs.size());
+
+            auto leaves = std::vector<Node>(runs.size());
+
+            for (std::size_t i = 0; i != leaves.size(); ++i)
+            {
+                leaves[i].run = i;
+
+                load(leaves[i]);
+            }
+
+            if (!leaves.empty())
+            {
+                tree[0] = leaves.size() == 1 ? leaves[0] : build(1, leaves);
+            }
+        }
+
+        TupleMerger(const TupleMerger&) = delete;
+
+        TupleMerger(TupleMerger&&) = default;
+
+        public:
+        auto begin() noexcept -> Iterator
+        {
+            return Iterator(this);
+        }
+
+        auto end() noexcept -> std::default_sentinel_t
+        {
+            return std::default_sentinel;
+        }
+    };
+
+    // The merger keeps iterators into the runs, so rvalue runs are accepted only when they are borrowed ranges.
+    template<std::size_t... K, class R, class... U>
+    requires(sizeof...(K) != 0 && std::ranges::borrowed_range<R> && (... && std::ranges::borrowed_range<U>)
+             && (... && std::is_same_v<decltype(std::begin(std::declval<R&>())),
+                                       decltype(std::begin(std::declval<U&>()))>))
+    auto MergeSorted(R&& run, U&&... runs)
+    {
+        using I = decltype(std::begin(run));
+        using S = decltype(std::end  (run));
+
+        return TupleMerger<I, S, K...>(std::vector<std::pair<I, S>> {
+            std::pair<I, S>(std::begin(run ), std::end(run )),
+            std::pair<I, S>(std::begin(runs), std::end(runs))... });
+    }
+}
+
+#ifdef  D_AKR_TEST
+#include <span>
+#include <string>
+
+namespace akr::test
+{
+    template<class R>
+    concept MergeableRun = requires(R&& run) { MergeSorted<0>(std::forward<R>(run)); };
+
+    AKR_TEST(TupleMerger,
+    {
+        using V1 = decltype(Tuple(0, std::string(), 0));
+        using I1 = std::vector<V1>::iterator;
+        using M1 = TupleMerger<I1, I1, 2>;
+
+        auto r1 = std::vector<V1>({ V1(1, "A", 0), V1(4, "B", 0), V1(4, "B", 1), V1(9, "C", 0) });
+        auto r2 = std::vector<V1>({ V1(2, "D", 0), V1(4, "A", 0) });
+        auto r3 = std::vector<V1>();
+        auto r4 = std::vector<V1>({ V1(0, "E", 0), V1(10, "F", 0) });
+
+        auto keys   = std::vector<int>();
+        auto values = std::string();
+        for (auto&& e : MergeSorted<0, 1>(r1, r2, r3, r4))
+        {
+            auto value = std::move(e);
+            keys.push_back(value.IndexOf<0>());
+            values += value.IndexOf<1>();
+        }
+        AKR_CHECK((keys == std::vector<int>({ 0, 1, 2, 4, 4, 4, 9, 10 })));
+        AKR_CHECK(values == "EADABBCF");
+        AKR_CHECK(r1[1].IndexOf<1>().empty());
+
+        auto r5 = std::vector<V1>({ V1(3, "A", 0), V1(3, "B", 1) });
+        auto r6 = std::vector<V1>({ V1(3, "C", 2) });
+        auto order = std::string();
+        for (auto&& e : MergeSorted<0>(r5, r6))
+        {
+            order += e.IndexOf<1>();
+        }
+        AKR_CHECK(order == "ABC");
+
+        static_assert( MergeableRun<std::vector<V1>&>);
+        static_assert( MergeableRun<std::span<V1>>);
+        static_assert(!MergeableRun<std::vector<V1>>);
+
+        auto m1 = MergeSorted<0>(r3);
+        AKR_CHECK(m1.begin() == m1.end());
+
+        auto r7 = std::vector<V1>({ V1(5, "X", 0), V1(6, "Y", 3) });
+        auto r8 = std::vector<V1>({ V1(7, "Z", 1) });
+        auto runs = std::vector<decltype(std::pair(r7.begin(), r7.end()))>();
+        runs.emplace_back(r7.begin(), r7.end());
+        runs.emplace_back(r8.begin(), r8.end());
+
+        order.clear();
+        for (auto&& e : M1(std::move(runs)))
+        {
+            order += e.IndexOf<1>();
+        }
+        AKR_CHECK(order == "XZY");
+    });
+}
+#endif//D_AKR_TEST
+
+#endif//Z_AKR_TUPLE_MERGER_HH
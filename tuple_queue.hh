@@ -0,0 +1,522 @@
+#ifndef Z_AKR_TUPLE_QUEUE_HH
+#define Z_AKR_TUPLE_QUEUE_HH
+
+#include "tuple.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+
+namespace akr
+{
+    template<class... T>
+    struct SpscTupleQueue final
+    {
+        public:
+        using Value = Tuple<T...>;
+
+        inline static constexpr bool IsTrivial = std::is_trivially_copyable_v<Value>;
+
+        private:
+        struct Slot final
+        {
+            public:
+            alignas(Value) unsigned char storage[sizeof(Value)];
+        };
+
+        std::size_t mask;
+
+        std::unique_ptr<Slot[]> slots;
+
+        alignas(64) std::atomic<std::size_t> head {};
+
+        std::size_t cachedTail {};
+
+        alignas(64) std::atomic<std::size_t> tail {};
+
+        std::size_t cachedHead {};
+
+        auto at(std::size_t index) noexcept -> Value*
+        {
+            return std::launder(reinterpret_cast<Value*>(slots[index & mask].storage));
+        }
+
+        public:
+        explicit SpscTupleQueue(std::size_t capacity):
+            mask  { std::bit_ceil(capacity < 2 ? std::size_t(2) : capacity) - 1 },
+            slots { std::make_unique<Slot[]>(mask + 1) }
+        {
+        }
+
+        SpscTupleQueue(const SpscTupleQueue&) = delete;
+
+        ~SpscTupleQueue()
+        {
+            for (auto i = head.load(std::memory_order_relaxed); i != tail.load(std::memory_order_relaxed); ++i)
+            {
+                std::destroy_at(at(i));
+            }
+        }
+
+        public:
+        auto operator=(const SpscTupleQueue&) -> SpscTupleQueue& = delete;
+
+        public:
+        auto Capacity() const noexcept -> std::size_t
+        {
+            return mask + 1;
+        }
+
+        template<class... V>
+        requires(std::is_constructible_v<Value, V&&...>)
+        auto TryEmplace(V&&... values)
+            noexcept(std::is_nothrow_constructible_v<Value, V&&...>) -> bool
+        {
+            auto index = tail.load(std::memory_order_relaxed);
+
+            if (index - cachedHead == Capacity())
+            {
+                cachedHead = head.load(std::memory_order_acquire);
+
+                if (index - cachedHead == Capacity())
+                {
+                    return false;
+                }
+            }
+
+            std::construct_at(reinterpret_cast<Value*>(slots[index & mask].storage), std::forward<V>(values)...);
+
+            tail.store(index + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        auto TryPop(Value& value)
+            noexcept(std::is_nothrow_move_assignable_v<Value>) -> bool
+        {
+            auto index = head.load(std::memory_order_relaxed);
+
+            if (index == cachedTail)
+            {
+                cachedTail = tail.load(std::memory_order_acquire);
+
+                if (index == cachedTail)
+                {
+                    return false;
+                }
+            }
+
+            value = std::move(*at(index));
+
+            std::destroy_at(at(index));
+
+            head.store(index + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        auto PushBatch(std::span<const Value> values)
+            noexcept(std::is_nothrow_copy_constructible_v<Value>) -> std::size_t
+        {
+            auto index = tail.load(std::memory_order_relaxed);
+
+            if (Capacity() - (index - cachedHead) < values.size())
+            {
+                cachedHead = head.load(std::memory_order_acquire);
+            }
+
+            auto count = std::min(values.size(), Capacity() - (index - cachedHead));
+
+            if constexpr (IsTrivial)
+            {
+                auto first = std::min(count, Capacity() - (index & mask));
+
+                std::memcpy(slots.get() + (index & mask), values.data(), first * sizeof(Slot));
+                std::memcpy(slots.get(), values.data() + first, (count - first) * sizeof(Slot));
+            }
+            else
+            {
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    std::construct_at(reinterpret_cast<Value*>(slots[(index + i) & mask].storage), values[i]);
+                }
+            }
+
+            tail.store(index + count, std::memory_order_release);
+
+            return count;
+        }
+
+        auto PopBatch(std::span<Value> values)
+            noexcept(std::is_nothrow_move_assignable_v<Value>) -> std::size_t
+        {
+            auto index = head.load(std::memory_order_relaxed);
+
+            if (cachedTail - index < values.size())
+            {
+                cachedTail = tail.load(std::memory_order_acquire);
+            }
+
+            auto count = std::min(values.size(), cachedTail - index);
+
+            if constexpr (IsTrivial)
+            {
+                auto first = std::min(count, Capacity() - (index & mask));
+
+                std::memcpy(static_cast<void*>(values.data()), slots.get() + (index & mask), first * sizeof(Slot));
+                std::memcpy(static_cast<void*>(values.data() + first), slots.get(), (count - first) * sizeof(Slot));
+            }
+            else
+            {
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    values[i] = std::move(*at(index + i));
+
+                    std::destroy_at(at(index + i));
+                }
+            }
+
+            head.store(index + count, std::memory_order_release);
+
+            return count;
+        }
+    };
+
+    template<class... T>
+    struct MpscTupleQueue final
+    {
+        public:
+        using Value = Tuple<T...>;
+
+        inline static constexpr bool IsTrivial = std::is_trivially_copyable_v<Value>;
+
+        private:
+        struct Slot final
+        {
+            public:
+            std::atomic<std::size_t> sequence;
+
+            alignas(Value) unsigned char storage[sizeof(Value)];
+        };
+
+        std::size_t mask;
+
+        std::unique_ptr<Slot[]> slots;
+
+        alignas(64) std::atomic<std::size_t> tail {};
+
+        alignas(64) std::size_t head {};
+
+        auto at(std::size_t index) noexcept -> Value*
+        {
+            return std::launder(reinterpret_cast<Value*>(slots[index & mask].storage));
+        }
+
+        auto claim(std::size_t count) noexcept -> std::size_t
+        {
+            auto index = tail.load(std::memory_order_relaxed);
+
+            while (true)
+            {
+                auto sequence = slots[(index + count - 1) & mask].sequence.load(std::memory_order_acquire);
+
+                auto distance = static_cast<std::ptrdiff_t>(sequence - (index + count - 1));
+
+                if (distance == 0)
+                {
+                    if (tail.compare_exchange_weak(index, index + count, std::memory_order_relaxed))
+                    {
+                        return index;
+                    }
+                }
+                else if (distance < 0)
+                {
+                    return ~std::size_t();
+                }
+                else
+                {
+                    index = tail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        public:
+        explicit MpscTupleQueue(std::size_t capacity):
+            mask  { std::bit_ceil(capacity < 2 ? std::size_t(2) : capacity) - 1 },
+            slots { std::make_unique<Slot[]>(mask + 1) }
+        {
+            for (std::size_t i = 0; i != mask + 1; ++i)
+            {
+                slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MpscTupleQueue(const MpscTupleQueue&) = delete;
+
+        ~MpscTupleQueue()
+        {
+            for (auto i = head; slots[i & mask].sequence.load(std::memory_order_relaxed) == i + 1; ++i)
+            {
+                std::destroy_at(at(i));
+            }
+        }
+
+        public:
+        auto operator=(const MpscTupleQueue&) -> MpscTupleQueue& = delete;
+
+        public:
+        auto Capacity() const noexcept -> std::size_t
+        {
+            return mask + 1;
+        }
+
+        template<class... V>
+        requires(std::is_constructible_v<Value, V&&...>)
+        auto TryEmplace(V&&... values)
+            noexcept(std::is_nothrow_constructible_v<Value, V&&...>) -> bool
+        {
+            auto index = claim(1);
+
+            if (index == ~std::size_t())
+            {
+                return false;
+            }
+
+            auto&& slot = slots[index & mask];
+
+            std::construct_at(reinterpret_cast<Value*>(slot.storage), std::forward<V>(values)...);
+
+            slot.sequence.store(index + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        auto TryPop(Value& value)
+            noexcept(std::is_nothrow_move_assignable_v<Value>) -> bool
+        {
+            auto&& slot = slots[head & mask];
+
+            if (slot.sequence.load(std::memory_order_acquire) != head + 1)
+            {
+                return false;
+            }
+
+            value = std::move(*at(head));
+
+            std::destroy_at(at(head));
+
+            slot.sequence.store(head + Capacity(), std::memory_order_release);
+
+            ++head;
+
+            return true;
+        }
+
+        auto PushBatch(std::span<const Value> values)
+            noexcept(std::is_nothrow_copy_constructible_v<Value>) -> std::size_t
+        {
+            if (values.empty() || values.size() > Capacity())
+            {
+                return 0;
+            }
+
+            auto index = claim(values.size());
+
+            if (index == ~std::size_t())
+            {
+                return 0;
+            }
+
+            for (std::size_t i = 0; i != values.size(); ++i)
+            {
+                auto&& slot = slots[(index + i) & mask];
+
+                if constexpr (IsTrivial)
+                {
+                    std::memcpy(slot.storage, &values[i], sizeof(Value));
+                }
+                else
+                {
+                    std::construct_at(reinterpret_cast<Value*>(slot.storage), values[i]);
+                }
+
+                slot.sequence.store(index + i + 1, std::memory_order_release);
+            }
+
+            return values.size();
+        }
+
+        auto PopBatch(std::span<Value> values)
+            noexcept(std::is_nothrow_move_assignable_v<Value>) -> std::size_t
+        {
+            auto count = std::size_t();
+
+            for (; count != values.size(); ++count)
+            {
+                auto&& slot = slots[head & mask];
+
+                if (slot.sequence.load(std::memory_order_acquire) != head + 1)
+                {
+                    break;
+                }
+
+                if constexpr (IsTrivial)
+                {
+                    std::memcpy(static_cast<void*>(&values[count]), slot.storage, sizeof(Value));
+                }
+                else
+                {
+                    values[count] = std::move(*at(head));
+
+                    std::destroy_at(at(head));
+                }
+
+                slot.sequence.store(head + Capacity(), std::memory_order_release);
+
+                ++head;
+            }
+
+            return count;
+        }
+    };
+}
+
+#ifdef  D_AKR_TEST
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace akr::test
+{
+    AKR_TEST(SpscTupleQueue,
+    {
+        using V1 = decltype(Tuple(0, std::string()));
+        using V2 = decltype(Tuple(0u, 0u));
+
+        auto q1 = SpscTupleQueue<int, std::string>(3);
+        AKR_CHECK(q1.Capacity() == 4);
+        static_assert(!q1.IsTrivial);
+
+        AKR_CHECK(q1.TryEmplace(1, "A"));
+        AKR_CHECK(q1.TryEmplace(Tuple(2, std::string("B"))));
+        AKR_CHECK(q1.TryEmplace(3, "C"));
+        AKR_CHECK(q1.TryEmplace(4, "D"));
+        AKR_CHECK(!q1.TryEmplace(5, "E"));
+
+        auto v1 = V1();
+        AKR_CHECK(q1.TryPop(v1));
+        AKR_CHECK(v1.IndexOf<0>() == 1);
+        AKR_CHECK(v1.IndexOf<1>() == "A");
+
+        auto b1 = std::vector<V1>(8);
+        AKR_CHECK(q1.PopBatch(b1) == 3);
+        AKR_CHECK(b1[2].IndexOf<1>() == "D");
+        AKR_CHECK(!q1.TryPop(v1));
+
+        AKR_CHECK(q1.PushBatch(std::span<const V1>(b1.data(), 3)) == 3);
+        AKR_CHECK(q1.TryEmplace(6, "F"));
+
+        auto q2 = SpscTupleQueue<std::uint32_t, std::uint32_t>(1024);
+        static_assert(q2.IsTrivial);
+
+        auto producer = std::thread([&]()
+        {
+            auto batch = std::vector<V2>();
+            for (auto i = 0u; i != 100000; i += 4)
+            {
+                batch.assign({ Tuple(i, i), Tuple(i + 1, i), Tuple(i + 2, i), Tuple(i + 3, i) });
+                for (auto span = std::span<const V2>(batch); !span.empty(); )
+                {
+                    auto pushed = q2.PushBatch(span);
+                    if (pushed == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                    span = span.subspan(pushed);
+                }
+            }
+        });
+
+        auto expected = 0u;
+        auto buffer   = std::vector<V2>(7);
+        while (expected != 100000)
+        {
+            auto count = q2.PopBatch(buffer);
+            if (count == 0)
+            {
+                std::this_thread::yield();
+            }
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                AKR_CHECK(buffer[i].IndexOf<0>() == expected++);
+            }
+        }
+        producer.join();
+    });
+
+    AKR_TEST(MpscTupleQueue,
+    {
+        using V1 = decltype(Tuple(0, std::string()));
+        using V2 = decltype(Tuple(0u, 0u));
+
+        auto q1 = MpscTupleQueue<int, std::string>(2);
+        AKR_CHECK(q1.TryEmplace(1, "A"));
+        AKR_CHECK(q1.TryEmplace(2, "B"));
+        AKR_CHECK(!q1.TryEmplace(3, "C"));
+
+        auto v1 = V1();
+        AKR_CHECK(q1.TryPop(v1));
+        AKR_CHECK(v1.IndexOf<1>() == "A");
+        AKR_CHECK(q1.TryEmplace(3, "C"));
+
+        auto q2 = MpscTupleQueue<std::uint32_t, std::uint32_t>(256);
+
+        auto producers = std::vector<std::thread>();
+        for (auto p = 0u; p != 4; ++p)
+        {
+            producers.emplace_back([&, p]()
+            {
+                for (auto i = 0u; i != 20000; )
+                {
+                    auto batch = V2(p, i);
+                    if (i % 2 ? q2.TryEmplace(p, i) : q2.PushBatch(std::span(&batch, 1)) == 1)
+                    {
+                        ++i;
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        std::uint32_t next[4] {};
+        auto total  = 0u;
+        auto buffer = std::vector<V2>(5);
+        while (total != 80000)
+        {
+            auto count = q2.PopBatch(buffer);
+            if (count == 0)
+            {
+                std::this_thread::yield();
+            }
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                AKR_CHECK(buffer[i].IndexOf<1>() == next[buffer[i].IndexOf<0>()]++);
+            }
+            total += static_cast<std::uint32_t>(count);
+        }
+        for (auto&& producer : producers)
+        {
+            producer.join();
+        }
+    });
+}
+#endif//D_AKR_TEST
+
+#endif//Z_AKR_TUPLE_QUEUE_HH
@@ -0,0 +1,337 @@
+#ifndef Z_AKR_WIRE_TUPLE_HH
+#define Z_AKR_WIRE_TUPLE_HH
+
+#include "tuple.hh"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace akr
+{
+    template<class T>
+    requires((std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) || std::is_enum_v<T>)
+    struct BE final
+    {
+        public:
+        using Type = T;
+
+        inline static constexpr std::endian Order = std::endian::big;
+    };
+
+    template<class T>
+    requires((std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) || std::is_enum_v<T>)
+    struct LE final
+    {
+        public:
+        using Type = T;
+
+        inline static constexpr std::endian Order = std::endian::little;
+    };
+
+    template<class... F>
+    requires(sizeof...(F) != 0)
+    struct WireTuple final
+    {
+        public:
+        static constexpr auto Count = sizeof...(F);
+
+        static constexpr auto Size = (... + sizeof(typename F::Type));
+
+        template<std::size_t I>
+        requires(I < Count)
+        using ElementType = typename TupleHelper<Tuple<F...>>::template ElementType<I>::Type;
+
+        private:
+        static_assert((... && (sizeof(typename F::Type) == 1 || sizeof(typename F::Type) == 2 ||
+                               sizeof(typename F::Type) == 4 || sizeof(typename F::Type) == 8)),
+                      "wire element type must be 1, 2, 4 or 8 bytes wide.");
+
+        inline static constexpr std::size_t Sizes[] = { sizeof(typename F::Type)... };
+
+        inline static constexpr std::endian Orders[] = { F::Order... };
+
+        template<std::size_t N>
+        using Raw = std::conditional_t<N == 1, std::uint8_t,
+                    std::conditional_t<N == 2, std::uint16_t,
+                    std::conditional_t<N == 4, std::uint32_t, std::uint64_t>>>;
+
+        template<class T>
+        static constexpr auto swap(T value) noexcept -> T
+        {
+            auto result = T();
+
+            for (std::size_t i = 0; i != sizeof(T); ++i, value >>= 8)
+            {
+                result = T((result << 8) | (value & 0xFF));
+            }
+
+            return result;
+        }
+
+        template<std::size_t I>
+        static auto get(const std::byte* data) noexcept -> ElementType<I>
+        {
+            auto raw = Raw<Sizes[I]>();
+
+            std::memcpy(&raw, data + OffsetOf<I>(), sizeof(raw));
+
+            if constexpr (Orders[I] != std::endian::native)
+            {
+                raw = swap(raw);
+            }
+
+            return std::bit_cast<ElementType<I>>(raw);
+        }
+
+        template<std::size_t I>
+        static void set(std::byte* data, const ElementType<I>& value) noexcept
+        {
+            auto raw = std::bit_cast<Raw<Sizes[I]>>(value);
+
+            if constexpr (Orders[I] != std::endian::native)
+            {
+                raw = swap(raw);
+            }
+
+            std::memcpy(data + OffsetOf<I>(), &raw, sizeof(raw));
+        }
+
+        public:
+        template<std::size_t I>
+        struct Reference final
+        {
+            friend struct WireTuple;
+
+            private:
+            std::byte* data;
+
+            explicit Reference(std::byte* data_) noexcept:
+                data { data_ }
+            {
+            }
+
+            public:
+            operator ElementType<I>() const noexcept
+            {
+                return WireTuple::get<I>(data);
+            }
+
+            auto operator=(const ElementType<I>& value) const noexcept -> const Reference&
+            {
+                WireTuple::set<I>(data, value);
+
+                return *this;
+            }
+
+            auto operator=(const Reference& rhs) const noexcept -> const Reference&
+            {
+                return *this = static_cast<ElementType<I>>(rhs);
+            }
+        };
+
+        private:
+        std::byte* data;
+
+        public:
+        explicit WireTuple(std::span<std::byte> bytes):
+            data { bytes.data() }
+        {
+            if (bytes.size() < Size)
+            {
+                throw std::out_of_range("buffer too small.");
+            }
+        }
+
+        public:
+        static auto Read(std::span<const std::byte> bytes) -> Tuple<typename F::Type...>
+        {
+            if (bytes.size() < Size)
+            {
+                throw std::out_of_range("buffer too small.");
+            }
+
+            return [&]<std::size_t... I_>(std::index_sequence<I_...>)
+            {
+                return Tuple<typename F::Type...>(WireTuple::get<I_>(bytes.data())...);
+            }
+            (std::make_index_sequence<Count>{});
+        }
+
+        template<std::size_t I>
+        requires(I < Count)
+        static consteval auto OffsetOf() noexcept -> std::size_t
+        {
+            auto offset = std::size_t();
+
+            for (std::size_t i = 0; i != I; ++i)
+            {
+                offset += Sizes[i];
+            }
+
+            return offset;
+        }
+
+        public:
+        template<class F_>
+        void ForEach(const F_& func)
+        {
+            [&]<std::size_t... I_>(std::index_sequence<I_...>)
+            {
+                (..., func(IndexOf<I_>()));
+            }
+            (std::make_index_sequence<Count>{});
+        }
+
+        template<class F_>
+        void IndexBy(std::size_t index, const F_& func)
+        {
+            [&]<size_t... I_>(std::index_sequence<I_...>)
+            {
+                if (index < Count)
+                {
+                    #ifdef __clang__
+                    #pragma clang diagnostic push
+                    #pragma clang diagnostic ignored "-Wunused-value"
+                    #endif
+                    (..., (I_ == index && (func(IndexOf<I_>()), false)));
+                    #ifdef __clang__
+                    #pragma clang diagnostic pop
+                    #endif
+                }
+                else
+                {
+                    throw std::out_of_range("index out of range.");
+                }
+            }
+            (std::make_index_sequence<Count>{});
+        }
+
+        template<std::size_t I>
+        requires(I < Count)
+        auto IndexOf()       noexcept -> Reference<I>
+        {
+            return Reference<I>(data);
+        }
+
+        public:
+        template<class F_>
+        void ForEach(const F_& func) const
+        {
+            [&]<std::size_t... I_>(std::index_sequence<I_...>)
+            {
+                (..., func(IndexOf<I_>()));
+            }
+            (std::make_index_sequence<Count>{});
+        }
+
+        template<class F_>
+        void IndexBy(std::size_t index, const F_& func) const
+        {
+            [&]<size_t... I_>(std::index_sequence<I_...>)
+            {
+                if (index < Count)
+                {
+                    #ifdef __clang__
+                    #pragma clang diagnostic push
+                    #pragma clang diagnostic ignored "-Wunused-value"
+                    #endif
+                    (..., (I_ == index && (func(IndexOf<I_>()), false)));
+                    #ifdef __clang__
+                    #pragma clang diagnostic pop
+                    #endif
+                }
+                else
+                {
+                    throw std::out_of_range("index out of range.");
+                }
+            }
+            (std::make_index_sequence<Count>{});
+        }
+
+        template<std::size_t I>
+        requires(I < Count)
+        auto IndexOf() const noexcept -> ElementType<I>
+        {
+            return WireTuple::get<I>(data);
+        }
+
+        auto Materialize() const noexcept -> Tuple<typename F::Type...>
+        {
+            return [&]<std::size_t... I_>(std::index_sequence<I_...>)
+            {
+                return Tuple<typename F::Type...>(IndexOf<I_>()...);
+            }
+            (std::make_index_sequence<Count>{});
+        }
+    };
+}
+
+#ifdef  D_AKR_TEST
+namespace akr::test
+{
+    AKR_TEST(WireTuple,
+    {
+        using W1 = WireTuple<BE<std::uint32_t>, LE<std::uint16_t>,
+                             BE<std::uint64_t>, BE<std::int16_t>, BE<float>>;
+
+        static_assert(W1::Size == 4 + 2 + 8 + 2 + 4);
+        static_assert(W1::OffsetOf<0>() == 0);
+        static_assert(W1::OffsetOf<2>() == 6);
+        static_assert(W1::OffsetOf<4>() == 16);
+        static_assert(std::is_same_v<std::int16_t, W1::ElementType<3>>);
+
+        std::byte buffer[W1::Size + 1] {};
+
+        auto bytes = std::span(buffer + 1, W1::Size);
+
+        auto raw = [&](auto... values) { auto i = 0; (..., (bytes[i++] = std::byte(values))); };
+        raw(0x12, 0x34, 0x56, 0x78, 0x34, 0x12, 0, 0, 0, 0, 0, 0, 0x01, 0x02, 0xFF, 0xFE, 0x3F, 0x80, 0x00, 0x00);
+
+        auto w1 = W1(bytes);
+        AKR_CHECK(w1.IndexOf<0>() == 0x12345678u);
+        AKR_CHECK(w1.IndexOf<1>() == 0x1234u);
+        AKR_CHECK(w1.IndexOf<2>() == 0x0102u);
+        AKR_CHECK(w1.IndexOf<3>() == -2);
+        AKR_CHECK(w1.IndexOf<4>() == 1.0f);
+
+        w1.IndexOf<0>() = 0xAABBCCDDu;
+        AKR_CHECK(bytes[0] == std::byte(0xAA));
+        AKR_CHECK(bytes[3] == std::byte(0xDD));
+
+        w1.IndexOf<1>() = std::uint16_t(0xAABB);
+        AKR_CHECK(bytes[4] == std::byte(0xBB));
+        AKR_CHECK(bytes[5] == std::byte(0xAA));
+
+        w1.IndexBy(3, [](auto&& e) { e = std::int16_t(-1); });
+        AKR_CHECK(bytes[16 - 2] == std::byte(0xFF));
+        AKR_CHECK(bytes[16 - 1] == std::byte(0xFF));
+
+        auto count = 0;
+        w1.ForEach([&](auto&&) { ++count; });
+        AKR_CHECK(count == 5);
+
+        auto m1 = w1.Materialize();
+        static_assert(std::is_same_v<decltype(Tuple(std::uint32_t(), std::uint16_t(), std::uint64_t(), std::int16_t(), 0.0f)), decltype(m1)>);
+        AKR_CHECK(m1.IndexOf<0>() == 0xAABBCCDDu);
+        AKR_CHECK(m1.IndexOf<3>() == -1);
+
+        auto m2 = W1::Read(std::as_bytes(bytes));
+        AKR_CHECK(m2.IndexOf<4>() == 1.0f);
+
+        auto thrown = false;
+        try
+        {
+            W1(std::span(buffer, W1::Size - 1));
+        }
+        catch (const std::out_of_range&)
+        {
+            thrown = true;
+        }
+        AKR_CHECK(thrown);
+    });
+}
+#endif//D_AKR_TEST
+
+#endif//Z_AKR_WIRE_TUPLE_HH